@@ -0,0 +1,427 @@
+#ifndef FIXED_MATRIX_H
+#define FIXED_MATRIX_H
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+
+// Derleme zamanında boyutu bilinen dense matrix.
+// Heap allocation ve virtual çağrı yoktur; elemanlar row-major olarak nesnenin içinde tutulur.
+// Döngü sınırları constexpr olduğu için derleyici 3x3 / 4x4 çarpımı tamamen açabilir (unroll).
+template<typename T, size_t R, size_t C>
+class FixedMatrix {
+private:
+    alignas(16) std::array<T, R * C> elements{};
+
+public:
+    using value_type = T;
+    static constexpr size_t ROWS = R;
+    static constexpr size_t COLS = C;
+
+    constexpr FixedMatrix() = default;
+
+    // Row-major initializer: FixedMatrix<int, 2, 2> m{{1, 2, 3, 4}};
+    constexpr explicit FixedMatrix(const std::array<T, R * C>& values) : elements(values) {}
+
+    static constexpr FixedMatrix identity() {
+        static_assert(R == C, "Identity matrix must be square");
+        FixedMatrix m;
+        for(size_t i = 0; i < R; ++i)
+            m.elements[i * C + i] = T(1);
+        return m;
+    }
+
+    static constexpr size_t getRows() { return R; }
+    static constexpr size_t getCols() { return C; }
+    static constexpr bool isSquare() { return R == C; }
+
+    // Bounds check'li erişim - Matrix<T> ile aynı arayüz
+    T get(size_t i, size_t j) const {
+        if(i >= R || j >= C)
+            throw std::out_of_range("Index out of range");
+        return elements[i * C + j];
+    }
+
+    void set(size_t i, size_t j, const T& value) {
+        if(i >= R || j >= C)
+            throw std::out_of_range("Index out of range");
+        elements[i * C + j] = value;
+    }
+
+    // Bounds check yapmayan erişim
+    constexpr T at(size_t i, size_t j) const noexcept { return elements[i * C + j]; }
+    constexpr T& operator()(size_t i, size_t j) noexcept { return elements[i * C + j]; }
+    constexpr const T& operator()(size_t i, size_t j) const noexcept { return elements[i * C + j]; }
+
+    std::pair<size_t, size_t> rowRange(size_t) const noexcept { return {0, C}; }
+    std::pair<size_t, size_t> colRange(size_t) const noexcept { return {0, R}; }
+
+    constexpr T* data() noexcept { return elements.data(); }
+    constexpr const T* data() const noexcept { return elements.data(); }
+    static constexpr size_t storageSize() { return R * C; }
+
+    constexpr FixedMatrix operator+(const FixedMatrix& other) const {
+        FixedMatrix result;
+        for(size_t k = 0; k < R * C; ++k)
+            result.elements[k] = elements[k] + other.elements[k];
+        return result;
+    }
+
+    constexpr FixedMatrix operator-(const FixedMatrix& other) const {
+        FixedMatrix result;
+        for(size_t k = 0; k < R * C; ++k)
+            result.elements[k] = elements[k] - other.elements[k];
+        return result;
+    }
+
+    constexpr FixedMatrix operator*(const T& scalar) const {
+        FixedMatrix result;
+        for(size_t k = 0; k < R * C; ++k)
+            result.elements[k] = elements[k] * scalar;
+        return result;
+    }
+
+    // (R x C) * (C x K) çarpımı - i-k-j sırası: en içteki döngü ardışık belleği gezer
+    template<size_t K>
+    constexpr FixedMatrix<T, R, K> operator*(const FixedMatrix<T, C, K>& other) const {
+        FixedMatrix<T, R, K> result;
+        for(size_t i = 0; i < R; ++i)
+            for(size_t k = 0; k < C; ++k) {
+                T aik = elements[i * C + k];
+                for(size_t j = 0; j < K; ++j)
+                    result(i, j) += aik * other(k, j);
+            }
+        return result;
+    }
+
+    // y = A * x
+    constexpr std::array<T, R> operator*(const std::array<T, C>& x) const {
+        std::array<T, R> y{};
+        for(size_t i = 0; i < R; ++i)
+            for(size_t j = 0; j < C; ++j)
+                y[i] += elements[i * C + j] * x[j];
+        return y;
+    }
+
+    constexpr FixedMatrix<T, C, R> transpose() const {
+        FixedMatrix<T, C, R> result;
+        for(size_t i = 0; i < R; ++i)
+            for(size_t j = 0; j < C; ++j)
+                result(j, i) = elements[i * C + j];
+        return result;
+    }
+
+    constexpr bool operator==(const FixedMatrix& other) const {
+        for(size_t k = 0; k < R * C; ++k)
+            if(elements[k] != other.elements[k])
+                return false;
+        return true;
+    }
+
+    constexpr bool operator!=(const FixedMatrix& other) const { return !(*this == other); }
+
+    void display() const {
+        for(size_t i = 0; i < R; ++i) {
+            for(size_t j = 0; j < C; ++j)
+                std::cout << elements[i * C + j] << " ";
+            std::cout << "\n";
+        }
+    }
+};
+
+// ---- Sabit boyutlu structured matrix'ler ----
+// Hepsi dinamik karşılıklarıyla aynı packed indekslemeyi kullanır.
+
+template<typename T, size_t N>
+class FixedDiagonalMatrix {
+private:
+    std::array<T, N> elements{};
+
+public:
+    using value_type = T;
+
+    static constexpr size_t getRows() { return N; }
+    static constexpr size_t getCols() { return N; }
+
+    constexpr T at(size_t i, size_t j) const noexcept { return (i == j) ? elements[i] : T(); }
+
+    T get(size_t i, size_t j) const {
+        if(i >= N || j >= N)
+            throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+
+    void set(size_t i, size_t j, const T& value) {
+        if(i >= N || j >= N)
+            throw std::out_of_range("Index out of range");
+        if(i == j)
+            elements[i] = value;
+        else if(value != T())
+            throw std::invalid_argument("Non-diagonal elements must be zero");
+    }
+
+    std::pair<size_t, size_t> rowRange(size_t i) const noexcept { return {i, i + 1}; }
+    std::pair<size_t, size_t> colRange(size_t j) const noexcept { return {j, j + 1}; }
+
+    constexpr std::array<T, N> operator*(const std::array<T, N>& x) const {
+        std::array<T, N> y{};
+        for(size_t i = 0; i < N; ++i)
+            y[i] = elements[i] * x[i];
+        return y;
+    }
+
+    constexpr FixedMatrix<T, N, N> toDense() const {
+        FixedMatrix<T, N, N> m;
+        for(size_t i = 0; i < N; ++i)
+            m(i, i) = elements[i];
+        return m;
+    }
+};
+
+template<typename T, size_t N>
+class FixedLowerTriangularMatrix {
+private:
+    std::array<T, (N * (N + 1)) / 2> elements{};
+
+public:
+    using value_type = T;
+
+    static constexpr size_t getRows() { return N; }
+    static constexpr size_t getCols() { return N; }
+
+    constexpr T at(size_t i, size_t j) const noexcept {
+        return (i >= j) ? elements[(i * (i + 1)) / 2 + j] : T();
+    }
+
+    T get(size_t i, size_t j) const {
+        if(i >= N || j >= N)
+            throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+
+    void set(size_t i, size_t j, const T& value) {
+        if(i >= N || j >= N)
+            throw std::out_of_range("Index out of range");
+        if(i >= j)
+            elements[(i * (i + 1)) / 2 + j] = value;
+        else if(value != T())
+            throw std::invalid_argument("Upper triangular elements must be zero");
+    }
+
+    std::pair<size_t, size_t> rowRange(size_t i) const noexcept { return {0, i + 1}; }
+    std::pair<size_t, size_t> colRange(size_t j) const noexcept { return {j, N}; }
+
+    constexpr std::array<T, N> operator*(const std::array<T, N>& x) const {
+        std::array<T, N> y{};
+        for(size_t i = 0; i < N; ++i)
+            for(size_t j = 0; j <= i; ++j)
+                y[i] += elements[(i * (i + 1)) / 2 + j] * x[j];
+        return y;
+    }
+
+    constexpr FixedMatrix<T, N, N> toDense() const {
+        FixedMatrix<T, N, N> m;
+        for(size_t i = 0; i < N; ++i)
+            for(size_t j = 0; j <= i; ++j)
+                m(i, j) = elements[(i * (i + 1)) / 2 + j];
+        return m;
+    }
+};
+
+template<typename T, size_t N>
+class FixedUpperTriangularMatrix {
+private:
+    std::array<T, (N * (N + 1)) / 2> elements{};
+
+public:
+    using value_type = T;
+
+    static constexpr size_t getRows() { return N; }
+    static constexpr size_t getCols() { return N; }
+
+    constexpr T at(size_t i, size_t j) const noexcept {
+        return (i <= j) ? elements[(j * (j + 1)) / 2 + i] : T();
+    }
+
+    T get(size_t i, size_t j) const {
+        if(i >= N || j >= N)
+            throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+
+    void set(size_t i, size_t j, const T& value) {
+        if(i >= N || j >= N)
+            throw std::out_of_range("Index out of range");
+        if(i <= j)
+            elements[(j * (j + 1)) / 2 + i] = value;
+        else if(value != T())
+            throw std::invalid_argument("Lower triangular elements must be zero");
+    }
+
+    std::pair<size_t, size_t> rowRange(size_t i) const noexcept { return {i, N}; }
+    std::pair<size_t, size_t> colRange(size_t j) const noexcept { return {0, j + 1}; }
+
+    constexpr std::array<T, N> operator*(const std::array<T, N>& x) const {
+        std::array<T, N> y{};
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i <= j; ++i)
+                y[i] += elements[(j * (j + 1)) / 2 + i] * x[j];
+        return y;
+    }
+
+    constexpr FixedMatrix<T, N, N> toDense() const {
+        FixedMatrix<T, N, N> m;
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i <= j; ++i)
+                m(i, j) = elements[(j * (j + 1)) / 2 + i];
+        return m;
+    }
+};
+
+template<typename T, size_t N>
+class FixedSymmetricMatrix {
+private:
+    std::array<T, (N * (N + 1)) / 2> elements{};
+
+    static constexpr size_t index(size_t i, size_t j) {
+        return (i <= j) ? (j * (j + 1)) / 2 + i : (i * (i + 1)) / 2 + j;
+    }
+
+public:
+    using value_type = T;
+
+    static constexpr size_t getRows() { return N; }
+    static constexpr size_t getCols() { return N; }
+
+    constexpr T at(size_t i, size_t j) const noexcept { return elements[index(i, j)]; }
+
+    T get(size_t i, size_t j) const {
+        if(i >= N || j >= N)
+            throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+
+    void set(size_t i, size_t j, const T& value) {
+        if(i >= N || j >= N)
+            throw std::out_of_range("Index out of range");
+        elements[index(i, j)] = value;
+    }
+
+    std::pair<size_t, size_t> rowRange(size_t) const noexcept { return {0, N}; }
+    std::pair<size_t, size_t> colRange(size_t) const noexcept { return {0, N}; }
+
+    constexpr std::array<T, N> operator*(const std::array<T, N>& x) const {
+        std::array<T, N> y{};
+        for(size_t i = 0; i < N; ++i)
+            for(size_t j = 0; j < N; ++j)
+                y[i] += elements[index(i, j)] * x[j];
+        return y;
+    }
+
+    constexpr FixedMatrix<T, N, N> toDense() const {
+        FixedMatrix<T, N, N> m;
+        for(size_t i = 0; i < N; ++i)
+            for(size_t j = 0; j < N; ++j)
+                m(i, j) = elements[index(i, j)];
+        return m;
+    }
+};
+
+// ---- SoA (Structure of Arrays) batch ----
+// Count adet R x C matrix: (i, j) bileşenleri tüm matrix'ler için ardışık saklanır,
+// data[(i * C + j) * count + k] = k. matrix'in (i, j) elemanı.
+// Böylece batch çarpımda en içteki döngü k üzerinden ardışık belleği gezer ve vektörleşir.
+template<typename T, size_t R, size_t C>
+class FixedMatrixBatch {
+private:
+    size_t count;
+    std::vector<T> elements;
+
+public:
+    explicit FixedMatrixBatch(size_t n) : count(n), elements(R * C * n) {}
+
+    size_t size() const { return count; }
+
+    // (i, j) bileşeninin tüm matrix'ler için dizisi
+    T* component(size_t i, size_t j) { return elements.data() + (i * C + j) * count; }
+    const T* component(size_t i, size_t j) const { return elements.data() + (i * C + j) * count; }
+
+    FixedMatrix<T, R, C> get(size_t k) const {
+        if(k >= count)
+            throw std::out_of_range("Index out of range");
+        FixedMatrix<T, R, C> m;
+        for(size_t i = 0; i < R; ++i)
+            for(size_t j = 0; j < C; ++j)
+                m(i, j) = component(i, j)[k];
+        return m;
+    }
+
+    void set(size_t k, const FixedMatrix<T, R, C>& m) {
+        if(k >= count)
+            throw std::out_of_range("Index out of range");
+        for(size_t i = 0; i < R; ++i)
+            for(size_t j = 0; j < C; ++j)
+                component(i, j)[k] = m(i, j);
+    }
+};
+
+// out[k] = a[k] * b[k], tüm k için
+// Batch, cache'e sığan parçalar halinde işlenir; her parçada tüm (i, j, p) üçlüleri tamamlanır.
+// Parçanın sonucu önce yerel blokta biriktirilir, out ancak sonra yazılır: out, a veya b ile aynı nesne olabilir.
+template<typename T, size_t R, size_t K, size_t C>
+void multiplyBatch(const FixedMatrixBatch<T, R, K>& a, const FixedMatrixBatch<T, K, C>& b,
+                   FixedMatrixBatch<T, R, C>& out) {
+    constexpr size_t CHUNK = 256;
+    size_t n = a.size();
+    if(b.size() != n || out.size() != n)
+        throw std::invalid_argument("Batch sizes do not match");
+    std::vector<T> block(R * C * CHUNK);
+    for(size_t begin = 0; begin < n; begin += CHUNK) {
+        size_t len = std::min(n - begin, CHUNK);
+        for(size_t i = 0; i < R; ++i)
+            for(size_t j = 0; j < C; ++j) {
+                T* acc = block.data() + (i * C + j) * CHUNK;
+                for(size_t k = 0; k < len; ++k)
+                    acc[k] = T();
+                for(size_t p = 0; p < K; ++p) {
+                    const T* lhs = a.component(i, p) + begin;
+                    const T* rhs = b.component(p, j) + begin;
+                    for(size_t k = 0; k < len; ++k)
+                        acc[k] += lhs[k] * rhs[k];
+                }
+            }
+        for(size_t c = 0; c < R * C; ++c)
+            std::copy(block.begin() + c * CHUNK, block.begin() + c * CHUNK + len, out.component(c / C, c % C) + begin);
+    }
+}
+
+// Tek bir matrix'i SoA düzenindeki N boyutlu noktalara uygular: points[c][k] = k. noktanın c. bileşeni
+// Yerinde dönüşüm (out[i] == points[i]) desteklenir: sonuçlar parça parça yerel blokta biriktirilir.
+template<typename T, size_t R, size_t C>
+void transformBatch(const FixedMatrix<T, R, C>& m, const std::array<const T*, C>& points,
+                    const std::array<T*, R>& out, size_t count) {
+    constexpr size_t CHUNK = 256;
+    std::vector<T> block(R * CHUNK);
+    for(size_t begin = 0; begin < count; begin += CHUNK) {
+        size_t len = std::min(count - begin, CHUNK);
+        for(size_t i = 0; i < R; ++i) {
+            T* acc = block.data() + i * CHUNK;
+            for(size_t k = 0; k < len; ++k)
+                acc[k] = T();
+            for(size_t j = 0; j < C; ++j) {
+                T coeff = m(i, j);
+                const T* src = points[j] + begin;
+                for(size_t k = 0; k < len; ++k)
+                    acc[k] += coeff * src[k];
+            }
+        }
+        for(size_t i = 0; i < R; ++i)
+            std::copy(block.begin() + i * CHUNK, block.begin() + i * CHUNK + len, out[i] + begin);
+    }
+}
+
+#endif // FIXED_MATRIX_H
@@ -0,0 +1,236 @@
+#include "matrix_ops.h"
+#include "packed_layout.h"
+#include "fixed_matrix.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// Fonksiyonu verilen sayıda çalıştırıp ortalama süreyi (ms) döndürür
+template<typename F>
+double measure(F&& f, int repeat) {
+    auto start = std::chrono::steady_clock::now();
+    for(int r = 0; r < repeat; ++r)
+        f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / repeat;
+}
+
+// Matrix'i get() ile n x n row-major yoğun diziye açar
+template<typename T>
+std::vector<T> densify(const Matrix<T>& m) {
+    size_t n = m.getRows();
+    std::vector<T> dense(n * n);
+    for(size_t i = 0; i < n; ++i)
+        for(size_t j = 0; j < n; ++j)
+            dense[i * n + j] = m.get(i, j);
+    return dense;
+}
+
+// Dense baseline: O(n²) matrix-vector çarpımı
+template<typename T>
+std::vector<T> denseMultiply(const std::vector<T>& a, const std::vector<T>& x) {
+    size_t n = x.size();
+    std::vector<T> y(n, T());
+    for(size_t i = 0; i < n; ++i)
+        for(size_t j = 0; j < n; ++j)
+            y[i] += a[i * n + j] * x[j];
+    return y;
+}
+
+// Dense baseline: pivotsuz Gauss eliminasyonu, O(n³)
+template<typename T>
+std::vector<T> denseSolve(std::vector<T> a, std::vector<T> b) {
+    size_t n = b.size();
+    for(size_t k = 0; k < n; ++k) {
+        for(size_t i = k + 1; i < n; ++i) {
+            T f = a[i * n + k] / a[k * n + k];
+            for(size_t j = k; j < n; ++j)
+                a[i * n + j] -= f * a[k * n + j];
+            b[i] -= f * b[k];
+        }
+    }
+    std::vector<T> x(n);
+    for(size_t i = n; i-- > 0;) {
+        T sum = b[i];
+        for(size_t j = i + 1; j < n; ++j)
+            sum -= a[i * n + j] * x[j];
+        x[i] = sum / a[i * n + i];
+    }
+    return x;
+}
+
+void report(const char* name, double structured, double dense) {
+    std::cout << name << ": structured " << structured << " ms, dense "
+              << dense << " ms, speedup x" << (dense / structured) << "\n";
+}
+
+int main() {
+    const size_t n = 1024;
+    const int repeat = 10;
+    std::vector<double> x(n);
+    for(size_t i = 0; i < n; ++i)
+        x[i] = 1.0 + static_cast<double>(i % 13);
+
+    std::cout << "n = " << n << " (ortalama " << repeat << " tekrar)\n";
+
+    DiagonalMatrix<double> dm(n);
+    LowerTriangularMatrix<double> ltm(n);
+    UpperTriangularMatrix<double> utm(n);
+    SymmetricMatrix<double> sm(n);
+    TridiagonalMatrix<double> tdm(n);
+    ToeplitzMatrix<double> tm(n);
+    for(size_t i = 0; i < n; ++i) {
+        dm.set(i, i, 2.0 + i % 3);
+        for(size_t j = 0; j <= i; ++j) {
+            ltm.set(i, j, (i == j) ? n : 1.0 / (1 + i + j));
+            utm.set(j, i, (i == j) ? n : 1.0 / (1 + i + j));
+            sm.set(i, j, 1.0 / (1 + i + j));
+        }
+        tdm.set(i, i, 4.0);
+        if(i + 1 < n) {
+            tdm.set(i, i + 1, 1.0);
+            tdm.set(i + 1, i, 1.0);
+        }
+        tm.set(0, i, 1.0 / (1 + i));
+        tm.set(i, 0, 1.0 / (1 + i));
+    }
+
+    std::vector<double> sink;
+    auto bench = [&](const char* name, const Matrix<double>& m, auto&& fast) {
+        std::vector<double> dense = densify(m);
+        double s = measure([&] { sink = fast(); }, repeat);
+        double d = measure([&] { sink = denseMultiply(dense, x); }, repeat);
+        report(name, s, d);
+    };
+
+    std::cout << "\n-- Matrix-vector multiply --\n";
+    bench("Diagonal", dm, [&] { return dm.multiply(x); });
+    bench("LowerTriangular", ltm, [&] { return ltm.multiply(x); });
+    bench("UpperTriangular", utm, [&] { return utm.multiply(x); });
+    bench("Symmetric", sm, [&] { return sm.multiply(x); });
+    bench("Tridiagonal", tdm, [&] { return tdm.multiply(x); });
+    bench("Toeplitz (FFT)", tm, [&] { return tm.multiply(x); });
+    bench("Toeplitz (direct)", tm, [&] { return tm.multiplyDirect(x); });
+
+    std::cout << "\n-- Linear solve --\n";
+    const size_t m = 256;  // Dense O(n³) baseline için küçük boyut
+    std::vector<double> b(m, 1.0);
+    TridiagonalMatrix<double> small(m);
+    LowerTriangularMatrix<double> smallLower(m);
+    for(size_t i = 0; i < m; ++i) {
+        small.set(i, i, 4.0);
+        if(i + 1 < m) {
+            small.set(i, i + 1, 1.0);
+            small.set(i + 1, i, 1.0);
+        }
+        for(size_t j = 0; j <= i; ++j)
+            smallLower.set(i, j, (i == j) ? m : 1.0);
+    }
+    std::vector<double> denseTri = densify(small);
+    std::vector<double> denseLower = densify(smallLower);
+    report("Tridiagonal (Thomas)",
+           measure([&] { sink = small.solve(b); }, repeat),
+           measure([&] { sink = denseSolve(denseTri, b); }, repeat));
+    report("LowerTriangular (forward subst.)",
+           measure([&] { sink = smallLower.solve(b); }, repeat),
+           measure([&] { sink = denseSolve(denseLower, b); }, repeat));
+
+    std::cout << "\n-- Element access: virtual get vs static dispatch --\n";
+    AnyMatrix<double> any = sm;
+    const Matrix<double>& base = sm;
+    double total = 0;
+    double virt = measure([&] {
+        for(size_t i = 0; i < n; ++i)
+            for(size_t j = 0; j < n; ++j)
+                total += base.get(i, j);
+    }, repeat);
+    double stat = measure([&] {
+        std::visit([&](const auto& concrete) {
+            for(size_t i = 0; i < n; ++i)
+                forEachInRow(concrete, i, [&](size_t, double v) { total += v; });
+        }, any);
+    }, repeat);
+    std::cout << "Symmetric sum: virtual " << virt << " ms, variant " << stat
+              << " ms, speedup x" << (virt / stat) << "\n";
+    report("Symmetric multiplyGeneric (variant)",
+           measure([&] { sink = multiply(any, x); }, repeat),
+           measure([&] { sink = denseMultiply(densify(sm), x); }, repeat));
+
+    std::cout << "\n-- Packed layouts (n = " << n << ") --\n";
+    const std::pair<const char*, PackedLayout> layouts[] = {
+        {"RowPacked", PackedLayout::RowPacked},
+        {"ColumnPacked", PackedLayout::ColumnPacked},
+        {"RectangularFull", PackedLayout::RectangularFull},
+        {"BlockedPacked", PackedLayout::BlockedPacked}};
+    for(const auto& entry : layouts) {
+        auto lower = PackedTriangular<double>::fromLower(ltm, entry.second);
+        auto sym = PackedTriangular<double>::fromSymmetric(sm, entry.second);
+        double mv = measure([&] { sink = lower.multiply(x); }, repeat);
+        double mt = measure([&] { sink = lower.multiplyTransposed(x); }, repeat);
+        double ms = measure([&] { sink = sym.multiplySymmetric(x); }, repeat);
+        double sv = measure([&] { sink = lower.solve(x); }, repeat);
+        double st = measure([&] { sink = lower.solveTransposed(x); }, repeat);
+        std::cout << entry.first << ": L*x " << mv << " ms, L^T*x " << mt
+                  << " ms, S*x " << ms << " ms, solve " << sv
+                  << " ms, solve^T " << st << " ms\n";
+    }
+
+    std::cout << "\n-- Banded solve --\n";
+    // 7-bant (kl = ku = 3) sistem, dense Gauss ile karşılaştırma
+    BandedMatrix<double> smallBand(m, 3, 3);
+    for(size_t i = 0; i < m; ++i) {
+        auto range = smallBand.rowRange(i);
+        for(size_t j = range.first; j < range.second; ++j)
+            smallBand.set(i, j, (i == j) ? 8.0 : -1.0);
+    }
+    std::vector<double> denseBand = densify(smallBand);
+    report("Banded 7-band LU (n = 256)",
+           measure([&] { sink = smallBand.solve(b); }, repeat),
+           measure([&] { sink = denseSolve(denseBand, b); }, repeat));
+    
+    const size_t large = 1000000;
+    BandedMatrix<double> largeBand(large, 3, 3);
+    for(size_t i = 0; i < large; ++i) {
+        auto range = largeBand.rowRange(i);
+        for(size_t j = range.first; j < range.second; ++j)
+            largeBand.set(i, j, (i == j) ? 8.0 : -1.0);
+    }
+    std::vector<double> largeB(large, 1.0);
+    std::cout << "Banded 7-band LU (n = " << large << "): "
+              << measure([&] { sink = largeBand.solve(largeB); }, 1) << " ms, matvec "
+              << measure([&] { sink = largeBand.multiply(largeB); }, repeat) << " ms\n";
+
+    std::cout << "\n-- Small fixed-size multiply (1M adet 4x4) --\n";
+    const size_t batch = 1000000;
+    std::vector<std::vector<double>> heapA(batch, std::vector<double>(16)), heapB = heapA, heapC = heapA;
+    std::vector<FixedMatrix<double, 4, 4>> fixedA(batch), fixedB(batch), fixedC(batch);
+    FixedMatrixBatch<double, 4, 4> soaA(batch), soaB(batch), soaC(batch);
+    for(size_t k = 0; k < batch; ++k) {
+        for(size_t e = 0; e < 16; ++e) {
+            heapA[k][e] = fixedA[k].data()[e] = static_cast<double>((k + e) % 7);
+            heapB[k][e] = fixedB[k].data()[e] = static_cast<double>((k * e) % 5);
+        }
+        soaA.set(k, fixedA[k]);
+        soaB.set(k, fixedB[k]);
+    }
+    double heapTime = measure([&] {
+        for(size_t k = 0; k < batch; ++k) {
+            std::vector<double> out(16, 0.0);  // Dinamik boyutlu matrix: çarpım başına allocation
+            for(size_t i = 0; i < 4; ++i)
+                for(size_t p = 0; p < 4; ++p)
+                    for(size_t j = 0; j < 4; ++j)
+                        out[i * 4 + j] += heapA[k][i * 4 + p] * heapB[k][p * 4 + j];
+            heapC[k] = std::move(out);
+        }
+    }, 3);
+    double fixedTime = measure([&] {
+        for(size_t k = 0; k < batch; ++k)
+            fixedC[k] = fixedA[k] * fixedB[k];
+    }, 3);
+    double soaTime = measure([&] { multiplyBatch(soaA, soaB, soaC); }, 3);
+    std::cout << "Heap vector: " << heapTime << " ms, FixedMatrix (AoS): " << fixedTime
+              << " ms, FixedMatrixBatch (SoA): " << soaTime << " ms\n";
+    total += heapC[batch - 1][0] + fixedC[batch - 1](0, 0) + soaC.get(batch - 1)(0, 0);
+
+    return (sink.empty() || total == 0) ? 1 : 0;
+}
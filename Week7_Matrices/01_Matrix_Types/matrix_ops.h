@@ -4,6 +4,61 @@
 #include <vector>
 #include <stdexcept>
 #include <iostream>
+#include <complex>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <algorithm>
+#include <cstddef>
+
+// İteratif radix-2 FFT (Cooley-Tukey) - a.size() 2'nin kuvveti olmalı
+inline void fftTransform(std::vector<std::complex<double>>& a, bool invert) {
+    size_t n = a.size();
+    
+    // Bit-reversal permütasyonu
+    for(size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for(; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if(i < j)
+            std::swap(a[i], a[j]);
+    }
+    
+    // Butterfly adımları
+    const double pi = std::acos(-1.0);
+    for(size_t len = 2; len <= n; len <<= 1) {
+        double angle = 2 * pi / len * (invert ? -1 : 1);
+        std::complex<double> wlen(std::cos(angle), std::sin(angle));
+        for(size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1);
+            for(size_t j = 0; j < len / 2; ++j) {
+                std::complex<double> u = a[i + j];
+                std::complex<double> v = a[i + j + len / 2] * w;
+                a[i + j] = u + v;
+                a[i + j + len / 2] = u - v;
+                w *= wlen;
+            }
+        }
+    }
+    
+    if(invert) {
+        for(auto& x : a)
+            x /= static_cast<double>(n);
+    }
+}
+
+// rowRange() ve at() sunan bir matrix'in i. satırını out'a yazar
+// Yapısal sıfırlar tek seferde doldurulur, sadece saklanan aralık okunur
+template<typename M, typename T>
+void fillRowFromRange(const M& m, size_t i, T* out) {
+    auto range = m.rowRange(i);
+    std::fill(out, out + range.first, T());
+    for(size_t j = range.first; j < range.second; ++j)
+        out[j] = m.at(i, j);
+    std::fill(out + range.second, out + m.getCols(), T());
+}
 
 // Temel Matrix sınıfı - tüm matrix türleri için base class
 template<typename T>
@@ -12,11 +67,22 @@ protected:
     std::vector<T> elements;
     size_t rows;
     size_t cols;
+    
+    // Matrix-vector işlemleri için boyut kontrolü
+    void checkVectorSize(const std::vector<T>& x, size_t expected) const {
+        if(x.size() != expected)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+    }
 
 public:
+    using value_type = T;
+    
     // Constructor - boyutları alır ve belleği ayırır
     Matrix(size_t r, size_t c) : elements(r * c), rows(r), cols(c) {}
     
+    // Compact storage kullanan türler için - r * c yerine sadece gereken kadar ayırır
+    Matrix(size_t r, size_t c, size_t storage) : elements(storage), rows(r), cols(c) {}
+    
     // Virtual destructor - polymorphic davranış için
     virtual ~Matrix() = default;
     
@@ -29,11 +95,24 @@ public:
     size_t getCols() const { return cols; }
     bool isSquare() const { return rows == cols; }
     
+    // Packed storage'a doğrudan erişim - bulk işlemler için
+    const T* data() const { return elements.data(); }
+    T* data() { return elements.data(); }
+    size_t storageSize() const { return elements.size(); }
+    
+    // i. satırı out[0..cols) dizisine yazar - satır başına tek virtual çağrı
+    virtual void copyRow(size_t i, T* out) const {
+        for(size_t j = 0; j < cols; ++j)
+            out[j] = get(i, j);
+    }
+    
     // Matrix'i ekrana yazdırma
     void display() const {
+        std::vector<T> row(cols);
         for(size_t i = 0; i < rows; ++i) {
+            copyRow(i, row.data());
             for(size_t j = 0; j < cols; ++j) {
-                std::cout << get(i, j) << " ";
+                std::cout << row[j] << " ";
             }
             std::cout << "\n";
         }
@@ -42,19 +121,30 @@ public:
 
 // Diagonal Matrix - sadece köşegen elemanları sıfırdan farklı
 template<typename T>
-class DiagonalMatrix : public Matrix<T> {
+class DiagonalMatrix final : public Matrix<T> {
 public:
     // n x n boyutunda diagonal matrix oluşturur
-    DiagonalMatrix(size_t n) : Matrix<T>(n, n) {
-        this->elements.resize(n);
-    }
+    DiagonalMatrix(size_t n) : Matrix<T>(n, n, n) {}
     
     T get(size_t i, size_t j) const override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+    
+    // Bounds check yapmayan, inline edilebilen erişim
+    T at(size_t i, size_t j) const noexcept {
         return (i == j) ? this->elements[i] : T();
     }
     
+    // i. satırda / j. sütunda saklanan elemanların [başlangıç, bitiş) aralığı
+    std::pair<size_t, size_t> rowRange(size_t i) const noexcept { return {i, i + 1}; }
+    std::pair<size_t, size_t> colRange(size_t j) const noexcept { return {j, j + 1}; }
+    
+    void copyRow(size_t i, T* out) const override {
+        fillRowFromRange(*this, i, out);
+    }
+    
     void set(size_t i, size_t j, const T& value) override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
@@ -63,23 +153,55 @@ public:
         else if(value != T())
             throw std::invalid_argument("Non-diagonal elements must be zero");
     }
+    
+    // y = D * x - O(n)
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        this->checkVectorSize(x, this->cols);
+        std::vector<T> y(this->rows);
+        for(size_t i = 0; i < this->rows; ++i)
+            y[i] = this->elements[i] * x[i];
+        return y;
+    }
+    
+    // D * x = b çözümü - O(n)
+    std::vector<T> solve(const std::vector<T>& b) const {
+        this->checkVectorSize(b, this->rows);
+        std::vector<T> x(this->rows);
+        for(size_t i = 0; i < this->rows; ++i) {
+            if(this->elements[i] == T())
+                throw std::runtime_error("Matrix is singular");
+            x[i] = b[i] / this->elements[i];
+        }
+        return x;
+    }
 };
 
 // Lower Triangular Matrix - alt üçgensel matrix
 template<typename T>
-class LowerTriangularMatrix : public Matrix<T> {
+class LowerTriangularMatrix final : public Matrix<T> {
 public:
     // n x n boyutunda alt üçgensel matrix oluşturur
-    LowerTriangularMatrix(size_t n) : Matrix<T>(n, n) {
-        this->elements.resize((n * (n + 1)) / 2);
-    }
+    LowerTriangularMatrix(size_t n) : Matrix<T>(n, n, (n * (n + 1)) / 2) {}
     
     T get(size_t i, size_t j) const override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+    
+    // Bounds check yapmayan, inline edilebilen erişim
+    T at(size_t i, size_t j) const noexcept {
         return (i >= j) ? this->elements[(i * (i + 1)) / 2 + j] : T();
     }
     
+    // i. satırda / j. sütunda saklanan elemanların [başlangıç, bitiş) aralığı
+    std::pair<size_t, size_t> rowRange(size_t i) const noexcept { return {0, i + 1}; }
+    std::pair<size_t, size_t> colRange(size_t j) const noexcept { return {j, this->rows}; }
+    
+    void copyRow(size_t i, T* out) const override {
+        fillRowFromRange(*this, i, out);
+    }
+    
     void set(size_t i, size_t j, const T& value) override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
@@ -88,23 +210,66 @@ public:
         else if(value != T())
             throw std::invalid_argument("Upper triangular elements must be zero");
     }
+    
+    // y = L * x - O(n²/2), packed satırlar sırayla okunur
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        this->checkVectorSize(x, this->cols);
+        std::vector<T> y(this->rows);
+        const T* row = this->elements.data();
+        for(size_t i = 0; i < this->rows; ++i) {
+            T sum = T();
+            for(size_t j = 0; j <= i; ++j)
+                sum += row[j] * x[j];
+            y[i] = sum;
+            row += i + 1;
+        }
+        return y;
+    }
+    
+    // L * x = b çözümü - forward substitution, O(n²/2)
+    std::vector<T> solve(const std::vector<T>& b) const {
+        this->checkVectorSize(b, this->rows);
+        std::vector<T> x(this->rows);
+        const T* row = this->elements.data();
+        for(size_t i = 0; i < this->rows; ++i) {
+            T sum = b[i];
+            for(size_t j = 0; j < i; ++j)
+                sum -= row[j] * x[j];
+            if(row[i] == T())
+                throw std::runtime_error("Matrix is singular");
+            x[i] = sum / row[i];
+            row += i + 1;
+        }
+        return x;
+    }
 };
 
 // Upper Triangular Matrix - üst üçgensel matrix
 template<typename T>
-class UpperTriangularMatrix : public Matrix<T> {
+class UpperTriangularMatrix final : public Matrix<T> {
 public:
     // n x n boyutunda üst üçgensel matrix oluşturur
-    UpperTriangularMatrix(size_t n) : Matrix<T>(n, n) {
-        this->elements.resize((n * (n + 1)) / 2);
-    }
+    UpperTriangularMatrix(size_t n) : Matrix<T>(n, n, (n * (n + 1)) / 2) {}
     
     T get(size_t i, size_t j) const override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+    
+    // Bounds check yapmayan, inline edilebilen erişim
+    T at(size_t i, size_t j) const noexcept {
         return (i <= j) ? this->elements[(j * (j + 1)) / 2 + i] : T();
     }
     
+    // i. satırda / j. sütunda saklanan elemanların [başlangıç, bitiş) aralığı
+    std::pair<size_t, size_t> rowRange(size_t i) const noexcept { return {i, this->cols}; }
+    std::pair<size_t, size_t> colRange(size_t j) const noexcept { return {0, j + 1}; }
+    
+    void copyRow(size_t i, T* out) const override {
+        fillRowFromRange(*this, i, out);
+    }
+    
     void set(size_t i, size_t j, const T& value) override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
@@ -113,25 +278,65 @@ public:
         else if(value != T())
             throw std::invalid_argument("Lower triangular elements must be zero");
     }
+    
+    // y = U * x - O(n²/2), packed sütunlar sırayla okunur (axpy formu)
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        this->checkVectorSize(x, this->cols);
+        std::vector<T> y(this->rows, T());
+        const T* col = this->elements.data();
+        for(size_t j = 0; j < this->cols; ++j) {
+            for(size_t i = 0; i <= j; ++i)
+                y[i] += col[i] * x[j];
+            col += j + 1;
+        }
+        return y;
+    }
+    
+    // U * x = b çözümü - back substitution, O(n²/2)
+    // Sütun bazlı: x[j] bulununca j. sütunun katkısı b'den çıkarılır
+    std::vector<T> solve(const std::vector<T>& b) const {
+        this->checkVectorSize(b, this->rows);
+        std::vector<T> x(b);
+        for(size_t j = this->cols; j-- > 0;) {
+            const T* col = this->elements.data() + (j * (j + 1)) / 2;
+            if(col[j] == T())
+                throw std::runtime_error("Matrix is singular");
+            x[j] /= col[j];
+            for(size_t i = 0; i < j; ++i)
+                x[i] -= col[i] * x[j];
+        }
+        return x;
+    }
 };
 
 // Symmetric Matrix - simetrik matrix (aij = aji)
 template<typename T>
-class SymmetricMatrix : public Matrix<T> {
+class SymmetricMatrix final : public Matrix<T> {
 public:
     // n x n boyutunda simetrik matrix oluşturur
-    SymmetricMatrix(size_t n) : Matrix<T>(n, n) {
-        this->elements.resize((n * (n + 1)) / 2);
-    }
+    SymmetricMatrix(size_t n) : Matrix<T>(n, n, (n * (n + 1)) / 2) {}
     
     T get(size_t i, size_t j) const override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+    
+    // Bounds check yapmayan, inline edilebilen erişim
+    T at(size_t i, size_t j) const noexcept {
         return (i <= j) ? 
                this->elements[(j * (j + 1)) / 2 + i] : 
                this->elements[(i * (i + 1)) / 2 + j];
     }
     
+    // i. satırda / j. sütunda saklanan elemanların [başlangıç, bitiş) aralığı
+    std::pair<size_t, size_t> rowRange(size_t) const noexcept { return {0, this->cols}; }
+    std::pair<size_t, size_t> colRange(size_t) const noexcept { return {0, this->rows}; }
+    
+    void copyRow(size_t i, T* out) const override {
+        fillRowFromRange(*this, i, out);
+    }
+    
     void set(size_t i, size_t j, const T& value) override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
@@ -140,25 +345,44 @@ public:
         else
             this->elements[(i * (i + 1)) / 2 + j] = value;
     }
+    
+    // y = S * x - O(n²/2) okuma, her packed eleman iki kez kullanılır
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        this->checkVectorSize(x, this->cols);
+        std::vector<T> y(this->rows, T());
+        const T* col = this->elements.data();
+        for(size_t j = 0; j < this->cols; ++j) {
+            T sum = T();
+            for(size_t i = 0; i < j; ++i) {
+                y[i] += col[i] * x[j];   // üst üçgen katkısı
+                sum += col[i] * x[i];    // simetrik alt üçgen katkısı
+            }
+            y[j] += sum + col[j] * x[j];
+            col += j + 1;
+        }
+        return y;
+    }
 };
 
 // Tridiagonal Matrix - üç köşegenli matrix
 template<typename T>
-class TridiagonalMatrix : public Matrix<T> {
+class TridiagonalMatrix final : public Matrix<T> {
 public:
     // n x n boyutunda üç köşegenli matrix oluşturur
-    TridiagonalMatrix(size_t n) : Matrix<T>(n, n) {
-        // n×n matrix için:
-        // n eleman ana köşegen için
-        // (n-1) eleman üst köşegen için
-        // (n-1) eleman alt köşegen için
-        this->elements.resize(3 * n - 2);
-    }
+    // n×n matrix için:
+    // n eleman ana köşegen için
+    // (n-1) eleman üst köşegen için
+    // (n-1) eleman alt köşegen için
+    TridiagonalMatrix(size_t n) : Matrix<T>(n, n, 3 * n - 2) {}
     
     T get(size_t i, size_t j) const override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
-            
+        return at(i, j);
+    }
+    
+    // Bounds check yapmayan, inline edilebilen erişim
+    T at(size_t i, size_t j) const noexcept {
         if(i == j) // Ana köşegen
             return this->elements[i];
         else if(i == j + 1) // Alt köşegen
@@ -168,6 +392,14 @@ public:
         return T();
     }
     
+    // i. satırda / j. sütunda saklanan elemanların [başlangıç, bitiş) aralığı
+    std::pair<size_t, size_t> rowRange(size_t i) const noexcept { return {i > 0 ? i - 1 : 0, std::min(i + 2, this->cols)}; }
+    std::pair<size_t, size_t> colRange(size_t j) const noexcept { return {j > 0 ? j - 1 : 0, std::min(j + 2, this->rows)}; }
+    
+    void copyRow(size_t i, T* out) const override {
+        fillRowFromRange(*this, i, out);
+    }
+    
     void set(size_t i, size_t j, const T& value) override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
@@ -181,24 +413,85 @@ public:
         else if(value != T())
             throw std::invalid_argument("Only tridiagonal elements can be non-zero");
     }
+    
+    // y = A * x - O(n)
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        this->checkVectorSize(x, this->cols);
+        size_t n = this->rows;
+        const T* diag = this->elements.data();
+        const T* lower = diag + n;
+        const T* upper = diag + 2 * n - 1;
+        
+        std::vector<T> y(n);
+        for(size_t i = 0; i < n; ++i) {
+            T sum = diag[i] * x[i];
+            if(i > 0)
+                sum += lower[i - 1] * x[i - 1];
+            if(i + 1 < n)
+                sum += upper[i] * x[i + 1];
+            y[i] = sum;
+        }
+        return y;
+    }
+    
+    // A * x = b çözümü - Thomas algoritması, O(n)
+    // Pivoting yapılmaz; diagonal dominant sistemler için kararlıdır
+    std::vector<T> solve(const std::vector<T>& b) const {
+        this->checkVectorSize(b, this->rows);
+        size_t n = this->rows;
+        const T* diag = this->elements.data();
+        const T* lower = diag + n;
+        const T* upper = diag + 2 * n - 1;
+        
+        std::vector<T> c(n), x(n);
+        
+        // Forward sweep
+        if(diag[0] == T())
+            throw std::runtime_error("Matrix is singular");
+        c[0] = (n > 1) ? upper[0] / diag[0] : T();
+        x[0] = b[0] / diag[0];
+        for(size_t i = 1; i < n; ++i) {
+            T denom = diag[i] - lower[i - 1] * c[i - 1];
+            if(denom == T())
+                throw std::runtime_error("Matrix is singular");
+            c[i] = (i + 1 < n) ? upper[i] / denom : T();
+            x[i] = (b[i] - lower[i - 1] * x[i - 1]) / denom;
+        }
+        
+        // Back substitution
+        for(size_t i = n - 1; i-- > 0;)
+            x[i] -= c[i] * x[i + 1];
+        return x;
+    }
 };
 
 // Toeplitz Matrix - her köşegende sabit değerli matrix
 template<typename T>
-class ToeplitzMatrix : public Matrix<T> {
+class ToeplitzMatrix final : public Matrix<T> {
 public:
     // n x n boyutunda Toeplitz matrix oluşturur
-    ToeplitzMatrix(size_t n) : Matrix<T>(n, n) {
-        this->elements.resize(2 * n - 1);  // n eleman ilk satır + (n-1) eleman ilk sütun için
-    }
+    // n eleman ilk satır + (n-1) eleman ilk sütun için
+    ToeplitzMatrix(size_t n) : Matrix<T>(n, n, 2 * n - 1) {}
     
     T get(size_t i, size_t j) const override {
         if(i >= this->rows || j >= this->cols)
             throw std::out_of_range("Index out of range");
-        int diff = j - i;
-        if(diff >= 0)
-            return this->elements[diff];  // Üst üçgen ve köşegen
-        return this->elements[this->rows - 1 - diff];  // Alt üçgen
+        return at(i, j);
+    }
+    
+    // Bounds check yapmayan, inline edilebilen erişim
+    T at(size_t i, size_t j) const noexcept {
+        if(j >= i)
+            return this->elements[j - i];  // Üst üçgen ve köşegen
+        return this->elements[this->rows - 1 + (i - j)];  // Alt üçgen
+    }
+    
+    // i. satırda / j. sütunda saklanan elemanların [başlangıç, bitiş) aralığı
+    std::pair<size_t, size_t> rowRange(size_t) const noexcept { return {0, this->cols}; }
+    std::pair<size_t, size_t> colRange(size_t) const noexcept { return {0, this->rows}; }
+    
+    void copyRow(size_t i, T* out) const override {
+        fillRowFromRange(*this, i, out);
     }
     
     void set(size_t i, size_t j, const T& value) override {
@@ -210,6 +503,302 @@ public:
         else
             this->elements[this->rows - 1 - diff] = value;  // Alt üçgen
     }
+    
+    // Bu boyutun altında doğrudan O(n²) çarpım FFT'den hızlıdır
+    static constexpr size_t FFT_THRESHOLD = 64;
+    
+    // Tamsayı T için FFT yalnızca max|t| * max|x| * n bu sınırı aşmıyorsa kullanılır: double FFT'nin
+    // yuvarlama hatası ~2^-53 * log(n) * |t| |x| n olduğundan sonuç 0.5'ten az sapar ve llround tamdır.
+    // Aşılırsa doğrudan çarpıma düşülür (sonuç her zaman multiplyDirect ile aynıdır).
+    static constexpr double EXACT_FFT_BOUND = 68719476736.0;  // 2^36
+    
+    // y = T * x - küçük n için O(n²), büyük n için FFT ile O(n log n)
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        this->checkVectorSize(x, this->cols);
+        size_t n = this->rows;
+        if(n < FFT_THRESHOLD)
+            return multiplyDirect(x);
+        if constexpr (std::is_integral_v<T>) {
+            auto magnitude = [](const std::vector<T>& v) {
+                double m = 0;
+                for(const T& value : v)
+                    m = std::max(m, std::fabs(static_cast<double>(value)));
+                return m;
+            };
+            if(magnitude(this->elements) * magnitude(x) * static_cast<double>(n) > EXACT_FFT_BOUND)
+                return multiplyDirect(x);
+        }
+        
+        // Köşegen değerlerini a[k] = t(k - (n-1)) şeklinde diz:
+        // y[i] = sum_j a[(n-1) + j - i] * x[j] = (a * reverse(x))[2n-2-i]
+        size_t size = 1;
+        while(size < 3 * n - 2)
+            size <<= 1;
+        
+        std::vector<std::complex<double>> fa(size), fx(size);
+        for(size_t k = 0; k < n - 1; ++k)
+            fa[k] = static_cast<double>(this->elements[2 * n - 2 - k]);  // alt köşegenler
+        for(size_t k = 0; k < n; ++k)
+            fa[n - 1 + k] = static_cast<double>(this->elements[k]);      // üst köşegenler
+        for(size_t m = 0; m < n; ++m)
+            fx[m] = static_cast<double>(x[n - 1 - m]);
+        
+        fftTransform(fa, false);
+        fftTransform(fx, false);
+        for(size_t k = 0; k < size; ++k)
+            fa[k] *= fx[k];
+        fftTransform(fa, true);
+        
+        std::vector<T> y(n);
+        for(size_t i = 0; i < n; ++i) {
+            double v = fa[2 * n - 2 - i].real();
+            if constexpr (std::is_integral_v<T>)
+                y[i] = static_cast<T>(std::llround(v));
+            else
+                y[i] = static_cast<T>(v);
+        }
+        return y;
+    }
+    
+    // y = T * x - doğrudan O(n²) çarpım
+    std::vector<T> multiplyDirect(const std::vector<T>& x) const {
+        this->checkVectorSize(x, this->cols);
+        size_t n = this->rows;
+        std::vector<T> y(n);
+        for(size_t i = 0; i < n; ++i) {
+            T sum = T();
+            for(size_t j = 0; j < i; ++j)
+                sum += this->elements[n - 1 + i - j] * x[j];
+            for(size_t j = i; j < n; ++j)
+                sum += this->elements[j - i] * x[j];
+            y[i] = sum;
+        }
+        return y;
+    }
+};
+
+// Banded matrix'in LU faktörizasyonu (partial pivoting, LAPACK dgbtrf düzeni)
+template<typename T>
+class BandedLU {
+private:
+    size_t n, kl, ku, ld;
+    std::vector<T> ab;           // L çarpanları ve U (bant genişliği kl + ku)
+    std::vector<size_t> pivots;  // i. adımda i ile yer değiştiren satır
+
+    // A(i, j) -> ab[(kl + ku + i - j) + j * ld]
+    T& band(size_t i, size_t j) { return ab[kl + ku + i - j + j * ld]; }
+    const T& band(size_t i, size_t j) const { return ab[kl + ku + i - j + j * ld]; }
+
+public:
+    // Band storage'ı alır ve yerinde faktörize eder - O(n * kl * (kl + ku))
+    BandedLU(size_t size, size_t lower, size_t upper, std::vector<T> storage)
+        : n(size), kl(lower), ku(upper), ld(2 * lower + upper + 1),
+          ab(std::move(storage)), pivots(size) {
+        size_t lastCol = 0;  // Şu ana kadar etkilenen son sütun
+        for(size_t j = 0; j < n; ++j) {
+            size_t km = std::min(kl, n - 1 - j);
+            
+            // Pivot seçimi: j. sütunda en büyük mutlak değer
+            size_t p = 0;
+            for(size_t t = 1; t <= km; ++t)
+                if(std::abs(band(j + t, j)) > std::abs(band(j + p, j)))
+                    p = t;
+            pivots[j] = j + p;
+            if(band(j + p, j) == T())
+                throw std::runtime_error("Matrix is singular");
+            
+            lastCol = std::max(lastCol, std::min(j + ku + p, n - 1));
+            if(p != 0)
+                for(size_t c = j; c <= lastCol; ++c)
+                    std::swap(band(j, c), band(j + p, c));
+            
+            // L çarpanları ve rank-1 güncelleme (sadece bant içinde)
+            T pivot = band(j, j);
+            for(size_t t = 1; t <= km; ++t)
+                band(j + t, j) /= pivot;
+            for(size_t c = j + 1; c <= lastCol; ++c) {
+                T ujc = band(j, c);
+                if(ujc == T()) continue;
+                for(size_t t = 1; t <= km; ++t)
+                    band(j + t, c) -= band(j + t, j) * ujc;
+            }
+        }
+    }
+
+    // A * x = b çözümü - O(n * (2kl + ku))
+    std::vector<T> solve(const std::vector<T>& b) const {
+        if(b.size() != n)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        std::vector<T> x(b);
+        
+        // L * y = P * b
+        for(size_t j = 0; j + 1 < n; ++j) {
+            if(pivots[j] != j)
+                std::swap(x[j], x[pivots[j]]);
+            size_t lm = std::min(kl, n - 1 - j);
+            for(size_t t = 1; t <= lm; ++t)
+                x[j + t] -= band(j + t, j) * x[j];
+        }
+        
+        // U * x = y (U'nun üst bant genişliği kl + ku)
+        for(size_t j = n; j-- > 0;) {
+            x[j] /= band(j, j);
+            size_t first = (j > kl + ku) ? j - kl - ku : 0;
+            for(size_t i = first; i < j; ++i)
+                x[i] -= band(i, j) * x[j];
+        }
+        return x;
+    }
+};
+
+// Banded Matrix - alt bant genişliği kl, üst bant genişliği ku
+// LAPACK band storage: sütun bazlı, A(i, j) -> (kl + ku + i - j) + j * (2kl + ku + 1)
+// İlk kl satır LU sırasında pivoting kaynaklı fill-in için ayrılmıştır
+template<typename T>
+class BandedMatrix final : public Matrix<T> {
+private:
+    size_t kl;
+    size_t ku;
+    size_t ld;  // Sütun başına eleman sayısı: 2kl + ku + 1
+
+    bool inBand(size_t i, size_t j) const noexcept {
+        return i <= j + kl && j <= i + ku;
+    }
+
+public:
+    BandedMatrix(size_t n, size_t lower, size_t upper)
+        : Matrix<T>(n, n, (2 * lower + upper + 1) * n), kl(lower), ku(upper), ld(2 * lower + upper + 1) {}
+    
+    // Tridiagonal matrix, kl = ku = 1 olan özel durumdur
+    static BandedMatrix fromTridiagonal(const TridiagonalMatrix<T>& m) {
+        size_t n = m.getRows();
+        BandedMatrix result(n, 1, 1);
+        for(size_t i = 0; i < n; ++i) {
+            auto range = m.rowRange(i);
+            for(size_t j = range.first; j < range.second; ++j)
+                result.set(i, j, m.at(i, j));
+        }
+        return result;
+    }
+    
+    size_t getLowerBandwidth() const { return kl; }
+    size_t getUpperBandwidth() const { return ku; }
+    
+    T get(size_t i, size_t j) const override {
+        if(i >= this->rows || j >= this->cols)
+            throw std::out_of_range("Index out of range");
+        return at(i, j);
+    }
+    
+    void set(size_t i, size_t j, const T& value) override {
+        if(i >= this->rows || j >= this->cols)
+            throw std::out_of_range("Index out of range");
+        if(inBand(i, j))
+            this->elements[kl + ku + i - j + j * ld] = value;
+        else if(value != T())
+            throw std::invalid_argument("Elements outside the band must be zero");
+    }
+    
+    // Bounds check yapmayan, inline edilebilen erişim
+    T at(size_t i, size_t j) const noexcept {
+        return inBand(i, j) ? this->elements[kl + ku + i - j + j * ld] : T();
+    }
+    
+    // i. satırda / j. sütunda saklanan elemanların [başlangıç, bitiş) aralığı
+    std::pair<size_t, size_t> rowRange(size_t i) const noexcept {
+        return {i > kl ? i - kl : 0, std::min(i + ku + 1, this->cols)};
+    }
+    std::pair<size_t, size_t> colRange(size_t j) const noexcept {
+        return {j > ku ? j - ku : 0, std::min(j + kl + 1, this->rows)};
+    }
+    
+    void copyRow(size_t i, T* out) const override {
+        fillRowFromRange(*this, i, out);
+    }
+    
+    // y = A * x - O(n * (kl + ku + 1)), sütun bazlı axpy (storage sırası)
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        this->checkVectorSize(x, this->cols);
+        std::vector<T> y(this->rows, T());
+        for(size_t j = 0; j < this->cols; ++j) {
+            auto range = colRange(j);
+            const T* col = this->elements.data() + j * (ld - 1) + kl + ku;  // col[i] = A(i, j)
+            for(size_t i = range.first; i < range.second; ++i)
+                y[i] += col[i] * x[j];
+        }
+        return y;
+    }
+    
+    // Partial pivoting ile LU faktörizasyonu - O(n * kl * (kl + ku))
+    BandedLU<T> factorize() const {
+        return BandedLU<T>(this->rows, kl, ku, this->elements);
+    }
+    
+    // A * x = b çözümü - tek seferlik faktörizasyon + çözüm
+    std::vector<T> solve(const std::vector<T>& b) const {
+        this->checkVectorSize(b, this->rows);
+        return factorize().solve(b);
+    }
 };
 
+// ---- Statik dispatch: virtual çağrı olmadan tüm matrix türleri üzerinde ----
+
+// i. satırdaki saklanan elemanlar için f(j, value) çağırır
+template<typename M, typename F>
+void forEachInRow(const M& m, size_t i, F&& f) {
+    auto range = m.rowRange(i);
+    for(size_t j = range.first; j < range.second; ++j)
+        f(j, m.at(i, j));
+}
+
+// j. sütundaki saklanan elemanlar için f(i, value) çağırır
+template<typename M, typename F>
+void forEachInColumn(const M& m, size_t j, F&& f) {
+    auto range = m.colRange(j);
+    for(size_t i = range.first; i < range.second; ++i)
+        f(i, m.at(i, j));
+}
+
+// k. köşegen (j - i = k) boyunca f(i, j, value) çağırır
+template<typename M, typename F>
+void forEachInDiagonal(const M& m, std::ptrdiff_t k, F&& f) {
+    size_t i = (k < 0) ? static_cast<size_t>(-k) : 0;
+    size_t j = (k > 0) ? static_cast<size_t>(k) : 0;
+    for(; i < m.getRows() && j < m.getCols(); ++i, ++j)
+        f(i, j, m.at(i, j));
+}
+
+// Herhangi bir matrix türü için y = A * x - at() inline edilir
+template<typename M>
+std::vector<typename M::value_type> multiplyGeneric(const M& m, const std::vector<typename M::value_type>& x) {
+    using T = typename M::value_type;
+    if(x.size() != m.getCols())
+        throw std::invalid_argument("Vector size does not match matrix dimensions");
+    std::vector<T> y(m.getRows(), T());
+    for(size_t i = 0; i < m.getRows(); ++i) {
+        T sum = T();
+        forEachInRow(m, i, [&](size_t j, const T& v) { sum += v * x[j]; });
+        y[i] = sum;
+    }
+    return y;
+}
+
+// Tüm structured matrix türlerini tutan variant - std::visit ile statik dispatch
+template<typename T>
+using AnyMatrix = std::variant<DiagonalMatrix<T>, LowerTriangularMatrix<T>,
+                               UpperTriangularMatrix<T>, SymmetricMatrix<T>,
+                               TridiagonalMatrix<T>, ToeplitzMatrix<T>,
+                               BandedMatrix<T>>;
+
+// Variant içindeki matrix'i mevcut virtual arayüz üzerinden kullanmak için
+template<typename T>
+const Matrix<T>& asMatrix(const AnyMatrix<T>& m) {
+    return std::visit([](const auto& concrete) -> const Matrix<T>& { return concrete; }, m);
+}
+
+template<typename T>
+std::vector<T> multiply(const AnyMatrix<T>& m, const std::vector<T>& x) {
+    return std::visit([&](const auto& concrete) { return multiplyGeneric(concrete, x); }, m);
+}
+
 #endif // MATRIX_OPS_H 
\ No newline at end of file
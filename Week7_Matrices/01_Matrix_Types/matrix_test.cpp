@@ -1,6 +1,27 @@
 #include "matrix_ops.h"
+#include "packed_layout.h"
+#include "fixed_matrix.h"
 #include <cassert>
 #include <iostream>
+#include <cmath>
+#include <vector>
+
+// get() üzerinden yoğun (dense) matrix-vector çarpımı - referans sonuç
+template<typename T>
+std::vector<T> denseMultiply(const Matrix<T>& m, const std::vector<T>& x) {
+    std::vector<T> y(m.getRows(), T());
+    for(size_t i = 0; i < m.getRows(); ++i)
+        for(size_t j = 0; j < m.getCols(); ++j)
+            y[i] += m.get(i, j) * x[j];
+    return y;
+}
+
+bool approxEqual(const std::vector<double>& a, const std::vector<double>& b, double eps = 1e-9) {
+    if(a.size() != b.size()) return false;
+    for(size_t i = 0; i < a.size(); ++i)
+        if(std::fabs(a[i] - b[i]) > eps) return false;
+    return true;
+}
 
 void testDiagonalMatrix() {
     std::cout << "\nTesting Diagonal Matrix..." << std::endl;
@@ -159,6 +180,357 @@ void testToeplitzMatrix() {
     tm.display();
 }
 
+void testMatrixVectorMultiply() {
+    std::cout << "\nTesting Matrix-Vector Multiply..." << std::endl;
+    const size_t n = 5;
+    std::vector<int> x = {1, -2, 3, 4, -5};
+    
+    DiagonalMatrix<int> dm(n);
+    LowerTriangularMatrix<int> ltm(n);
+    UpperTriangularMatrix<int> utm(n);
+    SymmetricMatrix<int> sm(n);
+    TridiagonalMatrix<int> tdm(n);
+    for(size_t i = 0; i < n; ++i) {
+        dm.set(i, i, static_cast<int>(i + 1));
+        for(size_t j = 0; j <= i; ++j) {
+            ltm.set(i, j, static_cast<int>(i * n + j + 1));
+            utm.set(j, i, static_cast<int>(j * n + i + 2));
+            sm.set(i, j, static_cast<int>(i + 2 * j + 1));
+        }
+        tdm.set(i, i, 4);
+        if(i + 1 < n) {
+            tdm.set(i, i + 1, static_cast<int>(i + 1));
+            tdm.set(i + 1, i, -static_cast<int>(i + 2));
+        }
+    }
+    
+    assert(dm.multiply(x) == denseMultiply(dm, x));
+    assert(ltm.multiply(x) == denseMultiply(ltm, x));
+    assert(utm.multiply(x) == denseMultiply(utm, x));
+    assert(sm.multiply(x) == denseMultiply(sm, x));
+    assert(tdm.multiply(x) == denseMultiply(tdm, x));
+    
+    // Küçük Toeplitz doğrudan, büyük Toeplitz FFT yolunu kullanır
+    ToeplitzMatrix<int> small(n);
+    for(size_t j = 0; j < n; ++j) small.set(0, j, static_cast<int>(j + 1));
+    for(size_t i = 1; i < n; ++i) small.set(i, 0, -static_cast<int>(i));
+    assert(small.multiply(x) == denseMultiply(small, x));
+    
+    const size_t big = 2 * ToeplitzMatrix<int>::FFT_THRESHOLD + 3;
+    ToeplitzMatrix<int> tm(big);
+    std::vector<int> bx(big);
+    for(size_t j = 0; j < big; ++j) {
+        tm.set(0, j, static_cast<int>(j % 7) - 3);
+        bx[j] = static_cast<int>(j % 5) - 2;
+    }
+    for(size_t i = 1; i < big; ++i) tm.set(i, 0, static_cast<int>(i % 11) - 5);
+    assert(tm.multiply(bx) == tm.multiplyDirect(bx));
+    assert(tm.multiply(bx) == denseMultiply(tm, bx));
+    
+    // Büyük tamsayılar: double FFT tam olmaz, sonuç yine doğrudan çarpımla aynı olmalı
+    const size_t wide = 1000;
+    ToeplitzMatrix<long long> lm(wide);
+    std::vector<long long> lx(wide);
+    for(size_t j = 0; j < wide; ++j) {
+        lm.set(0, j, (j % 2 ? 1 : -1) * static_cast<long long>(1000000 - j * 37));
+        lx[j] = (j % 3 ? -1 : 1) * static_cast<long long>(999999 - j * 53);
+    }
+    for(size_t i = 1; i < wide; ++i) lm.set(i, 0, (i % 5 ? 1 : -1) * static_cast<long long>(1000000 - i * 11));
+    assert(lm.multiply(lx) == lm.multiplyDirect(lx));
+    // Küçük değerlerde büyük n FFT yolunda kalır ve yine tamdır
+    ToeplitzMatrix<long long> sm2(wide);
+    for(size_t j = 0; j < wide; ++j) {
+        sm2.set(0, j, static_cast<long long>(j % 201) - 100);
+        lx[j] = static_cast<long long>(j % 199) - 99;
+    }
+    for(size_t i = 1; i < wide; ++i) sm2.set(i, 0, static_cast<long long>(i % 97) - 48);
+    assert(sm2.multiply(lx) == sm2.multiplyDirect(lx));
+    
+    // Boyut uyumsuzluğu
+    try {
+        dm.multiply(std::vector<int>(n + 1));
+        assert(false);
+    } catch(const std::invalid_argument&) {}
+    
+    std::cout << "Matrix-vector multiply sonuçları dense referans ile aynı" << std::endl;
+}
+
+void testLinearSolvers() {
+    std::cout << "\nTesting Linear Solvers..." << std::endl;
+    const size_t n = 6;
+    std::vector<double> b = {1.0, 2.0, -1.0, 0.5, 3.0, -2.0};
+    
+    DiagonalMatrix<double> dm(n);
+    LowerTriangularMatrix<double> ltm(n);
+    UpperTriangularMatrix<double> utm(n);
+    TridiagonalMatrix<double> tdm(n);
+    for(size_t i = 0; i < n; ++i) {
+        dm.set(i, i, 2.0 + i);
+        for(size_t j = 0; j < i; ++j) {
+            ltm.set(i, j, 0.5 * (i + j));
+            utm.set(j, i, -0.25 * (i + j));
+        }
+        ltm.set(i, i, 3.0 + i);
+        utm.set(i, i, 1.0 + i);
+        tdm.set(i, i, 4.0);
+        if(i + 1 < n) {
+            tdm.set(i, i + 1, 1.0);
+            tdm.set(i + 1, i, -1.0);
+        }
+    }
+    
+    // A * solve(b) == b
+    assert(approxEqual(dm.multiply(dm.solve(b)), b));
+    assert(approxEqual(ltm.multiply(ltm.solve(b)), b));
+    assert(approxEqual(utm.multiply(utm.solve(b)), b));
+    assert(approxEqual(tdm.multiply(tdm.solve(b)), b));
+    
+    // Singular matrix
+    DiagonalMatrix<double> singular(2);
+    singular.set(0, 0, 1.0);
+    try {
+        singular.solve({1.0, 1.0});
+        assert(false);
+    } catch(const std::runtime_error&) {}
+    
+    std::cout << "Triangular/diagonal/Thomas çözümleri doğrulandı" << std::endl;
+}
+
+void testStaticDispatch() {
+    std::cout << "\nTesting Static Dispatch..." << std::endl;
+    const size_t n = 4;
+    
+    LowerTriangularMatrix<int> ltm(n);
+    TridiagonalMatrix<int> tdm(n);
+    for(size_t i = 0; i < n; ++i) {
+        for(size_t j = 0; j <= i; ++j)
+            ltm.set(i, j, static_cast<int>(10 * i + j));
+        tdm.set(i, i, 2);
+        if(i + 1 < n) {
+            tdm.set(i, i + 1, 1);
+            tdm.set(i + 1, i, 3);
+        }
+    }
+    
+    // Satır iteratörü sadece saklanan elemanları ziyaret eder
+    size_t visited = 0;
+    forEachInRow(ltm, 2, [&](size_t j, int v) { assert(v == ltm.get(2, j)); ++visited; });
+    assert(visited == 3);
+    
+    visited = 0;
+    forEachInColumn(tdm, 0, [&](size_t i, int v) { assert(v == tdm.get(i, 0)); ++visited; });
+    assert(visited == 2);
+    
+    int diagSum = 0;
+    forEachInDiagonal(tdm, -1, [&](size_t i, size_t j, int v) { assert(i == j + 1); diagSum += v; });
+    assert(diagSum == 3 * static_cast<int>(n - 1));
+    
+    // Raw storage erişimi
+    assert(ltm.storageSize() == n * (n + 1) / 2);
+    assert(ltm.data()[0] == ltm.get(0, 0));
+    
+    // Satır kopyalama yapısal sıfırları da doldurur
+    std::vector<int> row(n, -1);
+    tdm.copyRow(0, row.data());
+    assert(row[0] == 2 && row[1] == 1 && row[2] == 0 && row[3] == 0);
+    
+    // Variant üzerinden generic çarpım, member multiply ile aynı
+    std::vector<int> x = {1, 2, 3, 4};
+    AnyMatrix<int> any = ltm;
+    assert(multiply(any, x) == ltm.multiply(x));
+    assert(asMatrix(any).get(3, 1) == 31);
+    
+    any = tdm;
+    assert(multiply(any, x) == tdm.multiply(x));
+    assert(multiplyGeneric(tdm, x) == denseMultiply(tdm, x));
+    
+    std::cout << "Statik dispatch sonuçları virtual arayüz ile tutarlı" << std::endl;
+}
+
+void testPackedLayouts() {
+    std::cout << "\nTesting Packed Layouts..." << std::endl;
+    const PackedLayout layouts[] = {PackedLayout::RowPacked, PackedLayout::ColumnPacked,
+                                    PackedLayout::RectangularFull, PackedLayout::BlockedPacked};
+    
+    // Tek ve çift boyutlar RFP'nin iki durumunu da test eder
+    for(size_t n : {1, 6, 7, 10}) {
+        LowerTriangularMatrix<double> ltm(n);
+        UpperTriangularMatrix<double> utm(n);
+        SymmetricMatrix<double> sm(n);
+        for(size_t i = 0; i < n; ++i)
+            for(size_t j = 0; j <= i; ++j) {
+                double v = (i == j) ? 4.0 + i : 0.1 * (i + 2 * j + 1);
+                ltm.set(i, j, v);
+                utm.set(j, i, v);
+                sm.set(i, j, v);
+            }
+        std::vector<double> x(n), b(n);
+        for(size_t i = 0; i < n; ++i) {
+            x[i] = 1.0 + i;
+            b[i] = 2.0 - 0.5 * i;
+        }
+        
+        for(PackedLayout layout : layouts) {
+            auto lower = PackedTriangular<double>::fromLower(ltm, layout, 3);
+            auto upper = PackedTriangular<double>::fromUpper(utm, layout, 3);
+            auto sym = PackedTriangular<double>::fromSymmetric(sm, layout, 3);
+            
+            for(size_t i = 0; i < n; ++i)
+                for(size_t j = 0; j < n; ++j)
+                    assert(lower.get(i, j) == ltm.get(i, j));
+            
+            assert(approxEqual(lower.multiply(x), ltm.multiply(x)));
+            assert(approxEqual(upper.multiplyTransposed(x), utm.multiply(x)));
+            assert(approxEqual(sym.multiplySymmetric(x), sm.multiply(x)));
+            assert(approxEqual(lower.solve(b), ltm.solve(b)));
+            assert(approxEqual(upper.solveTransposed(b), utm.solve(b)));
+            
+            // Düzenler arası dönüşüm veriyi korur
+            auto back = lower.convertTo(PackedLayout::RowPacked);
+            for(size_t i = 0; i < n; ++i)
+                for(size_t j = 0; j <= i; ++j)
+                    assert(back.get(i, j) == ltm.get(i, j));
+        }
+    }
+    
+    std::cout << "Row/column/RFP/blocked düzenleri tutarlı" << std::endl;
+}
+
+void testBandedMatrix() {
+    std::cout << "\nTesting Banded Matrix..." << std::endl;
+    const size_t n = 9;
+    
+    // Pentadiagonal (kl = ku = 2) ve asimetrik (kl = 1, ku = 3) bantlar
+    for(auto bw : {std::pair<size_t, size_t>{2, 2}, std::pair<size_t, size_t>{1, 3}}) {
+        BandedMatrix<double> bm(n, bw.first, bw.second);
+        for(size_t i = 0; i < n; ++i) {
+            auto range = bm.rowRange(i);
+            for(size_t j = range.first; j < range.second; ++j)
+                bm.set(i, j, (i == j) ? 1.0 : 1.0 / (1.0 + i + 2 * j));
+        }
+        assert(bm.get(0, n - 1) == 0.0);
+        
+        std::vector<double> x(n), b(n);
+        for(size_t i = 0; i < n; ++i) {
+            x[i] = 1.0 - 0.3 * i;
+            b[i] = 0.5 + i;
+        }
+        assert(approxEqual(bm.multiply(x), denseMultiply(bm, x)));
+        assert(approxEqual(bm.multiply(bm.solve(b)), b));
+        
+        AnyMatrix<double> any = bm;
+        assert(approxEqual(multiply(any, x), bm.multiply(x)));
+    }
+    
+    // Sıfır diagonal -> partial pivoting gerekir
+    BandedMatrix<double> swapNeeded(3, 1, 1);
+    swapNeeded.set(0, 1, 1.0);
+    swapNeeded.set(1, 0, 2.0);
+    swapNeeded.set(1, 2, 1.0);
+    swapNeeded.set(2, 1, 1.0);
+    swapNeeded.set(2, 2, 3.0);
+    std::vector<double> rhs = {1.0, 2.0, 3.0};
+    assert(approxEqual(swapNeeded.multiply(swapNeeded.solve(rhs)), rhs));
+    
+    // Tridiagonal -> banded dönüşümü, Thomas ile aynı sonuç
+    TridiagonalMatrix<double> tdm(n);
+    for(size_t i = 0; i < n; ++i) {
+        tdm.set(i, i, 4.0);
+        if(i + 1 < n) {
+            tdm.set(i, i + 1, -1.0);
+            tdm.set(i + 1, i, 2.0);
+        }
+    }
+    std::vector<double> b(n, 1.0);
+    assert(approxEqual(BandedMatrix<double>::fromTridiagonal(tdm).solve(b), tdm.solve(b)));
+    
+    // Bant dışı eleman
+    try {
+        swapNeeded.set(0, 2, 5.0);
+        assert(false);
+    } catch(const std::invalid_argument&) {}
+    
+    std::cout << "Banded matvec ve LU çözümü doğrulandı" << std::endl;
+}
+
+void testFixedMatrix() {
+    std::cout << "\nTesting Fixed Matrix..." << std::endl;
+    
+    // constexpr çarpım derleme zamanında hesaplanır
+    constexpr FixedMatrix<int, 2, 3> a{{1, 2, 3, 4, 5, 6}};
+    constexpr FixedMatrix<int, 3, 2> b{{7, 8, 9, 10, 11, 12}};
+    constexpr FixedMatrix<int, 2, 2> c = a * b;
+    static_assert(c.at(0, 0) == 58 && c.at(0, 1) == 64, "constexpr multiply");
+    static_assert(c.at(1, 0) == 139 && c.at(1, 1) == 154, "constexpr multiply");
+    static_assert(sizeof(FixedMatrix<float, 4, 4>) == 16 * sizeof(float), "inline storage");
+    
+    FixedMatrix<double, 3, 3> rot{{0, -1, 0, 1, 0, 0, 0, 0, 1}};
+    auto id = FixedMatrix<double, 3, 3>::identity();
+    assert(rot * id == rot);
+    assert(rot * rot.transpose() == id);
+    std::array<double, 3> p = rot * std::array<double, 3>{1, 0, 0};
+    assert(p[0] == 0 && p[1] == 1 && p[2] == 0);
+    
+    // Structured fixed türler dinamik karşılıklarıyla aynı sonucu verir
+    FixedLowerTriangularMatrix<int, 3> fl;
+    FixedUpperTriangularMatrix<int, 3> fu;
+    FixedSymmetricMatrix<int, 3> fs;
+    FixedDiagonalMatrix<int, 3> fd;
+    LowerTriangularMatrix<int> ltm(3);
+    for(size_t i = 0; i < 3; ++i) {
+        fd.set(i, i, static_cast<int>(i + 1));
+        for(size_t j = 0; j <= i; ++j) {
+            int v = static_cast<int>(i * 3 + j + 1);
+            fl.set(i, j, v);
+            fu.set(j, i, v);
+            fs.set(i, j, v);
+            ltm.set(i, j, v);
+        }
+    }
+    std::array<int, 3> x = {1, -1, 2};
+    std::vector<int> vx(x.begin(), x.end());
+    std::vector<int> expected = ltm.multiply(vx);
+    std::array<int, 3> y = fl * x;
+    assert(std::vector<int>(y.begin(), y.end()) == expected);
+    assert(fl.toDense() * x == y);
+    assert(fu.toDense() * x == fu * x);
+    assert(fs.toDense() * x == fs * x);
+    assert(fd.toDense() * x == fd * x);
+    assert(fs.get(0, 2) == fs.get(2, 0));
+    
+    // SoA batch çarpım, tek tek çarpım ile aynı
+    const size_t count = 37;
+    FixedMatrixBatch<double, 3, 3> ba(count), bb(count), bc(count);
+    for(size_t k = 0; k < count; ++k) {
+        FixedMatrix<double, 3, 3> m1, m2;
+        for(size_t i = 0; i < 3; ++i)
+            for(size_t j = 0; j < 3; ++j) {
+                m1(i, j) = static_cast<double>(k + i * 3 + j);
+                m2(i, j) = static_cast<double>(k % 5) - static_cast<double>(i + j);
+            }
+        ba.set(k, m1);
+        bb.set(k, m2);
+    }
+    multiplyBatch(ba, bb, bc);
+    for(size_t k = 0; k < count; ++k)
+        assert(bc.get(k) == ba.get(k) * bb.get(k));
+    
+    // Nokta dönüşümü
+    std::vector<double> px = {1, 2}, py = {0, 1}, pz = {5, 6}, ox(2), oy(2), oz(2);
+    transformBatch(rot, {px.data(), py.data(), pz.data()}, {ox.data(), oy.data(), oz.data()}, 2);
+    assert(ox[1] == -1 && oy[1] == 2 && oz[1] == 6);
+    
+    // Yerinde kullanım: out girdilerle aynı bellek olabilir
+    FixedMatrixBatch<double, 3, 3> inPlace = ba;
+    multiplyBatch(inPlace, bb, inPlace);
+    for(size_t k = 0; k < count; ++k)
+        assert(inPlace.get(k) == bc.get(k));
+    transformBatch(rot, {px.data(), py.data(), pz.data()}, {px.data(), py.data(), pz.data()}, 2);
+    assert(px == ox && py == oy && pz == oz);
+    
+    std::cout << "Fixed-size matrix işlemleri doğrulandı" << std::endl;
+}
+
 int main() {
     try {
         testDiagonalMatrix();
@@ -167,6 +539,12 @@ int main() {
         testSymmetricMatrix();
         testTridiagonalMatrix();
         testToeplitzMatrix();
+        testMatrixVectorMultiply();
+        testLinearSolvers();
+        testStaticDispatch();
+        testPackedLayouts();
+        testBandedMatrix();
+        testFixedMatrix();
         
         std::cout << "\nTüm testler başarıyla tamamlandı!" << std::endl;
         return 0;
@@ -0,0 +1,424 @@
+#ifndef PACKED_LAYOUT_H
+#define PACKED_LAYOUT_H
+
+#include "matrix_ops.h"
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+// Alt üçgen için packed storage düzenleri
+enum class PackedLayout {
+    RowPacked,        // satır satır: (i*(i+1))/2 + j  (LowerTriangularMatrix ile aynı)
+    ColumnPacked,     // sütun sütun: j*n - (j*(j-1))/2 + (i-j)
+    RectangularFull,  // RFP: L11, L21, L22 blokları tek bir dikdörtgende
+    BlockedPacked     // B x B dense bloklar, bloklar row-packed sırada
+};
+
+// n x n alt üçgensel veriyi seçilebilir packed düzende tutar.
+// Upper triangular ve symmetric matrix'ler transpozları (alt üçgen) olarak saklanır,
+// bu yüzden multiplyTransposed / solveTransposed / multiplySymmetric de sağlanır.
+template<typename T>
+class PackedTriangular {
+private:
+    size_t n;
+    PackedLayout layout;
+    size_t blockSize;
+    std::vector<T> elements;
+
+    // RFP parametreleri: L11 n1 x n1, L22 n2 x n2, L21 n2 x n1
+    size_t n1() const { return n / 2; }
+    size_t n2() const { return n - n / 2; }
+    size_t rfpShift() const { return (n % 2 == 0) ? 1 : 0; }
+
+    size_t blockCount() const { return (n + blockSize - 1) / blockSize; }
+
+    size_t storageFor(size_t size, PackedLayout l, size_t b) const {
+        if(l == PackedLayout::BlockedPacked) {
+            size_t nb = (size + b - 1) / b;
+            return (nb * (nb + 1)) / 2 * b * b;
+        }
+        return (size * (size + 1)) / 2;
+    }
+
+    // Dikdörtgen içindeki (r, c) hücresini (i, j) koordinatına çevirir
+    // RFP ters dönüşümü; hücre kullanılmıyorsa false döner
+    bool rfpDecode(size_t r, size_t c, size_t& i, size_t& j) const {
+        size_t k1 = n1(), k2 = n2(), s = rfpShift();
+        if(r >= k2 + s) {                 // L21^T bölgesi
+            i = k1 + c;
+            j = r - k2 - s;
+            return true;
+        }
+        if(r >= c + s) {                  // L22 (diagonal dahil)
+            i = k1 + (r - s);
+            j = k1 + c;
+            return true;
+        }
+        // L11^T bölgesi: L11(a, b) -> (b, a + 1 - s)
+        if(c + s < 1) return false;
+        size_t a = c + s - 1;
+        if(a >= k1) return false;
+        i = a;
+        j = r;
+        return true;
+    }
+
+public:
+    PackedTriangular(size_t size, PackedLayout l = PackedLayout::RowPacked, size_t block = 32)
+        : n(size), layout(l), blockSize(block) {
+        if(block == 0)
+            throw std::invalid_argument("Block size must be positive");
+        elements.assign(storageFor(n, layout, blockSize), T());
+    }
+
+    // Mevcut matrix türlerinden dönüşüm.
+    // LowerTriangularMatrix ve UpperTriangularMatrix^T row-packed ile aynı bellek düzenine sahiptir.
+    static PackedTriangular fromLower(const LowerTriangularMatrix<T>& m,
+                                      PackedLayout l = PackedLayout::RowPacked, size_t block = 32) {
+        PackedTriangular rowPacked(m.getRows());
+        std::copy(m.data(), m.data() + m.storageSize(), rowPacked.elements.begin());
+        return rowPacked.convertTo(l, block);
+    }
+
+    static PackedTriangular fromUpper(const UpperTriangularMatrix<T>& m,
+                                      PackedLayout l = PackedLayout::RowPacked, size_t block = 32) {
+        PackedTriangular rowPacked(m.getRows());
+        std::copy(m.data(), m.data() + m.storageSize(), rowPacked.elements.begin());
+        return rowPacked.convertTo(l, block);
+    }
+
+    // Symmetric matrix'in alt üçgeni (üst üçgen column-packed == alt üçgen row-packed)
+    static PackedTriangular fromSymmetric(const SymmetricMatrix<T>& m,
+                                          PackedLayout l = PackedLayout::RowPacked, size_t block = 32) {
+        PackedTriangular rowPacked(m.getRows());
+        std::copy(m.data(), m.data() + m.storageSize(), rowPacked.elements.begin());
+        return rowPacked.convertTo(l, block);
+    }
+
+    size_t getSize() const { return n; }
+    PackedLayout getLayout() const { return layout; }
+    size_t getBlockSize() const { return blockSize; }
+    size_t storageSize() const { return elements.size(); }
+
+    // (i, j) için storage indeksi - i >= j olmalı
+    size_t index(size_t i, size_t j) const {
+        switch(layout) {
+        case PackedLayout::RowPacked:
+            return (i * (i + 1)) / 2 + j;
+        case PackedLayout::ColumnPacked:
+            return j * n - (j * (j - 1)) / 2 + (i - j);
+        case PackedLayout::RectangularFull: {
+            size_t k1 = n1(), k2 = n2(), s = rfpShift();
+            if(i < k1)                               // L11(i, j) -> (j, i + 1 - s)
+                return j * k2 + (i + 1 - s);
+            if(j >= k1)                              // L22(a, b) -> (a + s, b)
+                return (i - k1 + s) * k2 + (j - k1);
+            return (k2 + s + j) * k2 + (i - k1);     // L21(a, b) -> (k2 + s + b, a)
+        }
+        case PackedLayout::BlockedPacked: {
+            size_t bi = i / blockSize, bj = j / blockSize;
+            size_t block = (bi * (bi + 1)) / 2 + bj;
+            return block * blockSize * blockSize + (i % blockSize) * blockSize + (j % blockSize);
+        }
+        }
+        return 0;
+    }
+
+    T get(size_t i, size_t j) const {
+        if(i >= n || j >= n)
+            throw std::out_of_range("Index out of range");
+        return (i >= j) ? elements[index(i, j)] : T();
+    }
+
+    void set(size_t i, size_t j, const T& value) {
+        if(i >= n || j >= n)
+            throw std::out_of_range("Index out of range");
+        if(i >= j)
+            elements[index(i, j)] = value;
+        else if(value != T())
+            throw std::invalid_argument("Upper triangular elements must be zero");
+    }
+
+    // Saklanan her (i, j, value) için f çağırır - storage sırasıyla, yani cache dostu
+    template<typename F>
+    void forEachStored(F&& f) const {
+        switch(layout) {
+        case PackedLayout::RowPacked: {
+            const T* p = elements.data();
+            for(size_t i = 0; i < n; ++i)
+                for(size_t j = 0; j <= i; ++j)
+                    f(i, j, *p++);
+            break;
+        }
+        case PackedLayout::ColumnPacked: {
+            const T* p = elements.data();
+            for(size_t j = 0; j < n; ++j)
+                for(size_t i = j; i < n; ++i)
+                    f(i, j, *p++);
+            break;
+        }
+        case PackedLayout::RectangularFull: {
+            size_t k2 = n2(), rowsInRect = elements.size() / std::max<size_t>(k2, 1);
+            for(size_t r = 0; r < rowsInRect; ++r)
+                for(size_t c = 0; c < k2; ++c) {
+                    size_t i, j;
+                    if(rfpDecode(r, c, i, j))
+                        f(i, j, elements[r * k2 + c]);
+                }
+            break;
+        }
+        case PackedLayout::BlockedPacked: {
+            size_t nb = blockCount();
+            const T* p = elements.data();
+            for(size_t bi = 0; bi < nb; ++bi)
+                for(size_t bj = 0; bj <= bi; ++bj, p += blockSize * blockSize)
+                    for(size_t r = 0; r < blockSize; ++r) {
+                        size_t i = bi * blockSize + r;
+                        if(i >= n) break;
+                        size_t cEnd = (bi == bj) ? r + 1 : blockSize;
+                        for(size_t c = 0; c < cEnd; ++c) {
+                            size_t j = bj * blockSize + c;
+                            if(j >= n) break;
+                            f(i, j, p[r * blockSize + c]);
+                        }
+                    }
+            break;
+        }
+        }
+    }
+
+    // Başka bir düzene dönüştürür - O(n²/2)
+    PackedTriangular convertTo(PackedLayout target, size_t block = 32) const {
+        PackedTriangular result(n, target, block);
+        forEachStored([&](size_t i, size_t j, const T& v) {
+            result.elements[result.index(i, j)] = v;
+        });
+        return result;
+    }
+
+    // y = L * x
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        checkSize(x);
+        std::vector<T> y(n, T());
+        switch(layout) {
+        case PackedLayout::RowPacked: {            // satır dot product
+            const T* row = elements.data();
+            for(size_t i = 0; i < n; ++i, row += i) {
+                T sum = T();
+                for(size_t j = 0; j <= i; ++j)
+                    sum += row[j] * x[j];
+                y[i] = sum;
+            }
+            break;
+        }
+        case PackedLayout::ColumnPacked: {         // sütun axpy
+            const T* col = elements.data();
+            for(size_t j = 0; j < n; col += n - j, ++j)
+                for(size_t i = j; i < n; ++i)
+                    y[i] += col[i - j] * x[j];
+            break;
+        }
+        case PackedLayout::RectangularFull: {      // blok bazlı
+            size_t k1 = n1(), k2 = n2(), s = rfpShift();
+            const T* rect = elements.data();
+            // y1 = L11 * x1: dikdörtgenin b. satırı L11'in b. sütunu -> axpy
+            for(size_t b = 0; b < k1; ++b) {
+                const T* row = rect + b * k2 + (1 - s);
+                for(size_t a = b; a < k1; ++a)
+                    y[a] += row[a] * x[b];
+            }
+            // y2 = L21 * x1: L21^T satırları -> axpy
+            for(size_t b = 0; b < k1; ++b) {
+                const T* row = rect + (k2 + s + b) * k2;
+                for(size_t a = 0; a < k2; ++a)
+                    y[k1 + a] += row[a] * x[b];
+            }
+            // y2 += L22 * x2: satır dot product
+            for(size_t a = 0; a < k2; ++a) {
+                const T* row = rect + (a + s) * k2;
+                T sum = T();
+                for(size_t b = 0; b <= a; ++b)
+                    sum += row[b] * x[k1 + b];
+                y[k1 + a] += sum;
+            }
+            break;
+        }
+        case PackedLayout::BlockedPacked:          // blok satırı bazlı dense blok çarpımı
+            forEachStored([&](size_t i, size_t j, const T& v) { y[i] += v * x[j]; });
+            break;
+        }
+        return y;
+    }
+
+    // y = L^T * x (UpperTriangularMatrix kaynaklı veri için U * x)
+    std::vector<T> multiplyTransposed(const std::vector<T>& x) const {
+        checkSize(x);
+        std::vector<T> y(n, T());
+        forEachStored([&](size_t i, size_t j, const T& v) { y[j] += v * x[i]; });
+        return y;
+    }
+
+    // y = S * x, S = L + L^T - diag(L) (SymmetricMatrix kaynaklı veri için)
+    std::vector<T> multiplySymmetric(const std::vector<T>& x) const {
+        checkSize(x);
+        std::vector<T> y(n, T());
+        forEachStored([&](size_t i, size_t j, const T& v) {
+            y[i] += v * x[j];
+            if(i != j)
+                y[j] += v * x[i];
+        });
+        return y;
+    }
+
+    // L * x = b - forward substitution, düzene göre dot veya axpy formu
+    std::vector<T> solve(const std::vector<T>& b) const {
+        checkSize(b);
+        std::vector<T> x(b);
+        switch(layout) {
+        case PackedLayout::RowPacked: {            // dot formu
+            const T* row = elements.data();
+            for(size_t i = 0; i < n; ++i, row += i) {
+                T sum = x[i];
+                for(size_t j = 0; j < i; ++j)
+                    sum -= row[j] * x[j];
+                x[i] = divide(sum, row[i]);
+            }
+            break;
+        }
+        case PackedLayout::ColumnPacked: {         // axpy formu
+            const T* col = elements.data();
+            for(size_t j = 0; j < n; col += n - j, ++j) {
+                x[j] = divide(x[j], col[0]);
+                for(size_t i = j + 1; i < n; ++i)
+                    x[i] -= col[i - j] * x[j];
+            }
+            break;
+        }
+        case PackedLayout::RectangularFull: {
+            size_t k1 = n1(), k2 = n2(), s = rfpShift();
+            const T* rect = elements.data();
+            // x1 = L11^-1 b1 - L11 sütunları dikdörtgen satırlarında -> axpy
+            for(size_t c = 0; c < k1; ++c) {
+                const T* row = rect + c * k2 + (1 - s);
+                x[c] = divide(x[c], row[c]);
+                for(size_t a = c + 1; a < k1; ++a)
+                    x[a] -= row[a] * x[c];
+            }
+            // b2 -= L21 * x1
+            for(size_t c = 0; c < k1; ++c) {
+                const T* row = rect + (k2 + s + c) * k2;
+                for(size_t a = 0; a < k2; ++a)
+                    x[k1 + a] -= row[a] * x[c];
+            }
+            // x2 = L22^-1 b2 - satır dot formu
+            for(size_t a = 0; a < k2; ++a) {
+                const T* row = rect + (a + s) * k2;
+                T sum = x[k1 + a];
+                for(size_t c = 0; c < a; ++c)
+                    sum -= row[c] * x[k1 + c];
+                x[k1 + a] = divide(sum, row[a]);
+            }
+            break;
+        }
+        case PackedLayout::BlockedPacked: {        // blok forward substitution
+            size_t nb = blockCount(), bs = blockSize;
+            for(size_t bi = 0; bi < nb; ++bi) {
+                size_t rowEnd = std::min(n, (bi + 1) * bs);
+                // Önceki blok sütunlarının katkısını çıkar (dense bloklar)
+                for(size_t bj = 0; bj < bi; ++bj) {
+                    const T* blk = elements.data() + ((bi * (bi + 1)) / 2 + bj) * bs * bs;
+                    for(size_t i = bi * bs; i < rowEnd; ++i) {
+                        const T* row = blk + (i - bi * bs) * bs;
+                        T sum = T();
+                        for(size_t c = 0; c < bs; ++c)
+                            sum += row[c] * x[bj * bs + c];
+                        x[i] -= sum;
+                    }
+                }
+                // Diagonal bloğu çöz
+                const T* diag = elements.data() + ((bi * (bi + 1)) / 2 + bi) * bs * bs;
+                for(size_t i = bi * bs; i < rowEnd; ++i) {
+                    const T* row = diag + (i - bi * bs) * bs;
+                    T sum = x[i];
+                    for(size_t c = 0; c < i - bi * bs; ++c)
+                        sum -= row[c] * x[bi * bs + c];
+                    x[i] = divide(sum, row[i - bi * bs]);
+                }
+            }
+            break;
+        }
+        }
+        return x;
+    }
+
+    // L^T * x = b - back substitution (UpperTriangularMatrix kaynaklı veri için U * x = b)
+    std::vector<T> solveTransposed(const std::vector<T>& b) const {
+        checkSize(b);
+        std::vector<T> x(b);
+        switch(layout) {
+        case PackedLayout::RowPacked:               // L satırı = U sütunu -> axpy
+            for(size_t i = n; i-- > 0;) {
+                const T* row = elements.data() + (i * (i + 1)) / 2;
+                x[i] = divide(x[i], row[i]);
+                for(size_t j = 0; j < i; ++j)
+                    x[j] -= row[j] * x[i];
+            }
+            break;
+        case PackedLayout::ColumnPacked:            // L sütunu = U satırı -> dot
+            for(size_t j = n; j-- > 0;) {
+                const T* col = elements.data() + index(j, j);
+                T sum = x[j];
+                for(size_t i = j + 1; i < n; ++i)
+                    sum -= col[i - j] * x[i];
+                x[j] = divide(sum, col[0]);
+            }
+            break;
+        case PackedLayout::BlockedPacked: {         // blok back substitution
+            size_t nb = blockCount(), bs = blockSize;
+            for(size_t bi = nb; bi-- > 0;) {
+                size_t rowBegin = bi * bs, rowEnd = std::min(n, rowBegin + bs);
+                // Diagonal bloğun transpozunu çöz: satırlar axpy formunda
+                const T* diag = elements.data() + ((bi * (bi + 1)) / 2 + bi) * bs * bs;
+                for(size_t i = rowEnd; i-- > rowBegin;) {
+                    const T* row = diag + (i - rowBegin) * bs;
+                    x[i] = divide(x[i], row[i - rowBegin]);
+                    for(size_t c = 0; c < i - rowBegin; ++c)
+                        x[rowBegin + c] -= row[c] * x[i];
+                }
+                // Üstteki blok satırlarına katkıyı dağıt: b_j -= L_ij^T * x_i
+                for(size_t bj = 0; bj < bi; ++bj) {
+                    const T* blk = elements.data() + ((bi * (bi + 1)) / 2 + bj) * bs * bs;
+                    for(size_t i = rowBegin; i < rowEnd; ++i) {
+                        const T* row = blk + (i - rowBegin) * bs;
+                        for(size_t c = 0; c < bs; ++c)
+                            x[bj * bs + c] -= row[c] * x[i];
+                    }
+                }
+            }
+            break;
+        }
+        case PackedLayout::RectangularFull:         // indeks üzerinden
+            for(size_t i = n; i-- > 0;) {
+                x[i] = divide(x[i], elements[index(i, i)]);
+                for(size_t j = 0; j < i; ++j)
+                    x[j] -= elements[index(i, j)] * x[i];
+            }
+            break;
+        }
+        return x;
+    }
+
+private:
+    void checkSize(const std::vector<T>& x) const {
+        if(x.size() != n)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+    }
+
+    static T divide(const T& value, const T& pivot) {
+        if(pivot == T())
+            throw std::runtime_error("Matrix is singular");
+        return value / pivot;
+    }
+};
+
+#endif // PACKED_LAYOUT_H
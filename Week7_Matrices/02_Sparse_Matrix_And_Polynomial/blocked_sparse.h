@@ -0,0 +1,508 @@
+#ifndef BLOCKED_SPARSE_H
+#define BLOCKED_SPARSE_H
+
+#include "compressed_sparse.h"
+#include <vector>
+#include <variant>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+
+// SIMD dostu sparse formatlar.
+// CSR'da kısa satırlar iç döngüyü birkaç elemana indirir; derleyici vektörleyemez.
+// BSR küçük yoğun blokları, SELL-C-σ ise C satırı yan yana (lane) işleyerek
+// sabit genişlikli, vektörlenebilir iç döngüler sağlar.
+
+// Block Sparse Row (BSR) - R x C yoğun bloklar
+// blockPtr[b]..blockPtr[b+1] aralığı b. blok satırının bloklarıdır; blok sütunları sıralıdır.
+// Her blok row-major olarak R*C değer saklar; bloğun içindeki sıfırlar da saklanır (fill).
+template<typename T>
+class BSRMatrix {
+private:
+    size_t rows;
+    size_t cols;
+    size_t blockRows;  // R
+    size_t blockCols;  // C
+    size_t nnz;        // orijinal sıfır olmayan sayısı
+    std::vector<size_t> blockPtr;    // blok satırı sayısı + 1
+    std::vector<size_t> blockIndex;  // blok sütun indeksleri
+    std::vector<T> values;           // blok sayısı * R * C
+
+    size_t blockRowCount() const { return (rows + blockRows - 1) / blockRows; }
+    size_t blockColCount() const { return (cols + blockCols - 1) / blockCols; }
+
+    // Sabit boyutlu blok çekirdeği: R ve C derleme zamanında bilindiği için
+    // iç döngüler tamamen açılır ve vektörlenir
+    template<size_t R, size_t C>
+    void multiplyFixed(const T* x, T* y) const {
+        size_t nbr = blockRowCount();
+        for(size_t b = 0; b < nbr; ++b) {
+            T acc[R] = {};
+            for(size_t p = blockPtr[b]; p < blockPtr[b + 1]; ++p) {
+                const T* block = values.data() + p * R * C;
+                const T* xs = x + blockIndex[p] * C;
+                for(size_t r = 0; r < R; ++r)
+                    for(size_t c = 0; c < C; ++c)
+                        acc[r] += block[r * C + c] * xs[c];
+            }
+            for(size_t r = 0; r < R; ++r)
+                y[b * R + r] = acc[r];
+        }
+    }
+
+    void multiplyGeneric(const T* x, T* y) const {
+        size_t nbr = blockRowCount();
+        size_t area = blockRows * blockCols;
+        for(size_t b = 0; b < nbr; ++b) {
+            T* ys = y + b * blockRows;
+            std::fill(ys, ys + blockRows, T());
+            for(size_t p = blockPtr[b]; p < blockPtr[b + 1]; ++p) {
+                const T* block = values.data() + p * area;
+                const T* xs = x + blockIndex[p] * blockCols;
+                for(size_t r = 0; r < blockRows; ++r)
+                    for(size_t c = 0; c < blockCols; ++c)
+                        ys[r] += block[r * blockCols + c] * xs[c];
+            }
+        }
+    }
+
+public:
+    BSRMatrix(size_t r, size_t c, size_t br, size_t bc)
+        : rows(r), cols(c), blockRows(br), blockCols(bc), nnz(0) {
+        if(br == 0 || bc == 0)
+            throw std::invalid_argument("Block size must be positive");
+        blockPtr.assign(blockRowCount() + 1, 0);
+    }
+
+    // CSR -> BSR: her blok satırında kullanılan blok sütunları marker dizisiyle bulunur, O(nnz + blok)
+    static BSRMatrix fromCSR(const CSRMatrix<T>& a, size_t br, size_t bc) {
+        BSRMatrix result(a.getRows(), a.getCols(), br, bc);
+        const auto& ptr = a.getRowPointers();
+        const auto& idx = a.getColumnIndices();
+        const auto& val = a.getValues();
+        size_t nbr = result.blockRowCount();
+        size_t area = br * bc;
+        const size_t none = static_cast<size_t>(-1);
+        std::vector<size_t> slot(result.blockColCount(), none);
+        std::vector<size_t> used;
+
+        result.nnz = val.size();
+        for(size_t b = 0; b < nbr; ++b) {
+            size_t rowBegin = b * br;
+            size_t rowEnd = std::min(rowBegin + br, a.getRows());
+            used.clear();
+            for(size_t i = rowBegin; i < rowEnd; ++i)
+                for(size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+                    size_t bj = idx[p] / bc;
+                    if(slot[bj] == none) {
+                        slot[bj] = 0;
+                        used.push_back(bj);
+                    }
+                }
+            std::sort(used.begin(), used.end());
+
+            size_t base = result.blockIndex.size();
+            for(size_t k = 0; k < used.size(); ++k) {
+                slot[used[k]] = base + k;
+                result.blockIndex.push_back(used[k]);
+            }
+            result.values.resize(result.blockIndex.size() * area, T());
+            for(size_t i = rowBegin; i < rowEnd; ++i)
+                for(size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+                    size_t j = idx[p];
+                    size_t blockPos = slot[j / bc];
+                    result.values[blockPos * area + (i - rowBegin) * bc + j % bc] = val[p];
+                }
+            for(size_t bj : used)
+                slot[bj] = none;
+            result.blockPtr[b + 1] = result.blockIndex.size();
+        }
+        return result;
+    }
+
+    size_t getRows() const { return rows; }
+    size_t getCols() const { return cols; }
+    size_t getBlockRows() const { return blockRows; }
+    size_t getBlockCols() const { return blockCols; }
+    size_t getBlockCount() const { return blockIndex.size(); }
+    size_t getNonZeroCount() const { return nnz; }
+
+    // Saklanan değer / gerçek sıfır olmayan oranı (1.0 = hiç fill yok)
+    double fillRatio() const {
+        return nnz == 0 ? 1.0 : static_cast<double>(values.size()) / nnz;
+    }
+
+    // Element alma - blok satırında binary search, O(log blok)
+    T get(size_t i, size_t j) const {
+        if(i >= rows || j >= cols)
+            throw std::out_of_range("Index out of range");
+        size_t b = i / blockRows;
+        auto first = blockIndex.begin() + blockPtr[b];
+        auto last = blockIndex.begin() + blockPtr[b + 1];
+        auto it = std::lower_bound(first, last, j / blockCols);
+        if(it == last || *it != j / blockCols)
+            return T();
+        size_t blockPos = it - blockIndex.begin();
+        return values[blockPos * blockRows * blockCols + (i % blockRows) * blockCols + j % blockCols];
+    }
+
+    // y = A * x - yaygın blok boyutları sabit boyutlu çekirdeklere yönlendirilir
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        if(x.size() != cols)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        // Son blok satırı/sütunu taşabileceği için x ve y blok katına kadar sıfırla uzatılır
+        std::vector<T> xs(blockColCount() * blockCols, T());
+        std::copy(x.begin(), x.end(), xs.begin());
+        std::vector<T> y(blockRowCount() * blockRows);
+
+        if(blockRows == 2 && blockCols == 2) multiplyFixed<2, 2>(xs.data(), y.data());
+        else if(blockRows == 3 && blockCols == 3) multiplyFixed<3, 3>(xs.data(), y.data());
+        else if(blockRows == 4 && blockCols == 4) multiplyFixed<4, 4>(xs.data(), y.data());
+        else if(blockRows == 8 && blockCols == 8) multiplyFixed<8, 8>(xs.data(), y.data());
+        else multiplyGeneric(xs.data(), y.data());
+
+        y.resize(rows);
+        return y;
+    }
+
+    CSRMatrix<T> toCSR() const {
+        std::vector<size_t> ptr(rows + 1, 0);
+        std::vector<size_t> index;
+        std::vector<T> vals;
+        index.reserve(nnz);
+        vals.reserve(nnz);
+        for(size_t i = 0; i < rows; ++i) {
+            size_t b = i / blockRows;
+            size_t r = i % blockRows;
+            for(size_t p = blockPtr[b]; p < blockPtr[b + 1]; ++p)
+                for(size_t c = 0; c < blockCols; ++c) {
+                    const T& v = values[p * blockRows * blockCols + r * blockCols + c];
+                    if(v != T()) {
+                        index.push_back(blockIndex[p] * blockCols + c);
+                        vals.push_back(v);
+                    }
+                }
+            ptr[i + 1] = vals.size();
+        }
+        return CSRMatrix<T>(rows, cols, std::move(ptr), std::move(index), std::move(vals));
+    }
+};
+
+// SELL-C-σ (Sliced ELLPACK) - Kreutzer ve ark.
+// Satırlar σ'lık pencereler içinde uzunluğa göre (azalan) sıralanır, ardışık C satır bir chunk olur.
+// Her chunk en uzun satırı kadar genişliktedir ve column-major saklanır:
+// chunk k'nın j. sütunundaki r. lane -> chunkPtr[k] + j * C + r.
+// Böylece iç döngü C satırı aynı anda işler (SIMD lane'leri); padding σ ile azaltılır.
+template<typename T>
+class SELLMatrix {
+private:
+    size_t rows;
+    size_t cols;
+    size_t chunkSize;  // C
+    size_t sigma;      // sıralama penceresi (C'nin katı)
+    size_t nnz;
+    std::vector<size_t> rowOrder;    // chunk lane -> orijinal satır (chunk sayısı * C, geçersiz lane = rows)
+    std::vector<size_t> chunkPtr;    // chunk sayısı + 1, slot cinsinden
+    std::vector<size_t> colIndex;    // padding slotlarında satırın geçerli bir sütunu
+    std::vector<T> values;           // padding slotlarında T()
+
+    size_t chunkCount() const { return (rows + chunkSize - 1) / chunkSize; }
+
+    template<size_t C>
+    void multiplyFixed(const T* x, T* y) const {
+        size_t chunks = chunkCount();
+        for(size_t k = 0; k < chunks; ++k) {
+            T acc[C] = {};
+            size_t width = (chunkPtr[k + 1] - chunkPtr[k]) / C;
+            const T* val = values.data() + chunkPtr[k];
+            const size_t* idx = colIndex.data() + chunkPtr[k];
+            for(size_t j = 0; j < width; ++j)
+                for(size_t r = 0; r < C; ++r)
+                    acc[r] += val[j * C + r] * x[idx[j * C + r]];
+            for(size_t r = 0; r < C; ++r) {
+                size_t row = rowOrder[k * C + r];
+                if(row < rows)
+                    y[row] = acc[r];
+            }
+        }
+    }
+
+    void multiplyGeneric(const T* x, T* y) const {
+        size_t chunks = chunkCount();
+        std::vector<T> acc(chunkSize);
+        for(size_t k = 0; k < chunks; ++k) {
+            std::fill(acc.begin(), acc.end(), T());
+            size_t width = (chunkPtr[k + 1] - chunkPtr[k]) / chunkSize;
+            for(size_t j = 0; j < width; ++j)
+                for(size_t r = 0; r < chunkSize; ++r) {
+                    size_t slot = chunkPtr[k] + j * chunkSize + r;
+                    acc[r] += values[slot] * x[colIndex[slot]];
+                }
+            for(size_t r = 0; r < chunkSize; ++r) {
+                size_t row = rowOrder[k * chunkSize + r];
+                if(row < rows)
+                    y[row] = acc[r];
+            }
+        }
+    }
+
+public:
+    SELLMatrix(size_t r, size_t c, size_t chunk, size_t window)
+        : rows(r), cols(c), chunkSize(chunk), sigma(window), nnz(0) {
+        if(chunk == 0)
+            throw std::invalid_argument("Chunk size must be positive");
+        if(sigma < chunkSize)
+            sigma = chunkSize;
+        sigma = (sigma + chunkSize - 1) / chunkSize * chunkSize;
+        rowOrder.assign(chunkCount() * chunkSize, rows);
+        chunkPtr.assign(chunkCount() + 1, 0);
+    }
+
+    static SELLMatrix fromCSR(const CSRMatrix<T>& a, size_t chunk = 8, size_t window = 256) {
+        SELLMatrix result(a.getRows(), a.getCols(), chunk, window);
+        const auto& ptr = a.getRowPointers();
+        const auto& idx = a.getColumnIndices();
+        const auto& val = a.getValues();
+        size_t n = result.rows;
+        size_t C = result.chunkSize;
+        result.nnz = val.size();
+
+        // σ pencereleri içinde satır uzunluğuna göre azalan stable sıralama
+        for(size_t i = 0; i < n; ++i)
+            result.rowOrder[i] = i;
+        for(size_t w = 0; w < n; w += result.sigma) {
+            auto first = result.rowOrder.begin() + w;
+            auto last = result.rowOrder.begin() + std::min(w + result.sigma, n);
+            std::stable_sort(first, last, [&](size_t p, size_t q) {
+                return ptr[p + 1] - ptr[p] > ptr[q + 1] - ptr[q];
+            });
+        }
+
+        size_t chunks = result.chunkCount();
+        for(size_t k = 0; k < chunks; ++k) {
+            size_t width = 0;
+            for(size_t r = 0; r < C; ++r) {
+                size_t row = result.rowOrder[k * C + r];
+                if(row < n)
+                    width = std::max(width, ptr[row + 1] - ptr[row]);
+            }
+            result.chunkPtr[k + 1] = result.chunkPtr[k] + width * C;
+        }
+
+        result.colIndex.assign(result.chunkPtr[chunks], 0);
+        result.values.assign(result.chunkPtr[chunks], T());
+        for(size_t k = 0; k < chunks; ++k) {
+            size_t width = (result.chunkPtr[k + 1] - result.chunkPtr[k]) / C;
+            for(size_t r = 0; r < C; ++r) {
+                size_t row = result.rowOrder[k * C + r];
+                if(row >= n)
+                    continue;
+                size_t length = ptr[row + 1] - ptr[row];
+                // Padding, x erişimini yerel tutmak için satırın son sütununu tekrarlar
+                size_t padColumn = length > 0 ? idx[ptr[row + 1] - 1] : 0;
+                for(size_t j = 0; j < width; ++j) {
+                    size_t slot = result.chunkPtr[k] + j * C + r;
+                    if(j < length) {
+                        result.colIndex[slot] = idx[ptr[row] + j];
+                        result.values[slot] = val[ptr[row] + j];
+                    } else {
+                        result.colIndex[slot] = padColumn;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    size_t getRows() const { return rows; }
+    size_t getCols() const { return cols; }
+    size_t getChunkSize() const { return chunkSize; }
+    size_t getSigma() const { return sigma; }
+    size_t getNonZeroCount() const { return nnz; }
+
+    // Saklanan slot / gerçek sıfır olmayan oranı (1.0 = hiç padding yok)
+    double fillRatio() const {
+        return nnz == 0 ? 1.0 : static_cast<double>(values.size()) / nnz;
+    }
+
+    // Element alma - satırın chunk'ı bulunup genişlik boyunca taranır, O(genişlik)
+    T get(size_t i, size_t j) const {
+        if(i >= rows || j >= cols)
+            throw std::out_of_range("Index out of range");
+        // Satır yalnızca kendi σ penceresi içinde yer değiştirmiş olabilir
+        size_t windowBegin = i / sigma * sigma;
+        size_t windowEnd = std::min(windowBegin + sigma, rows);
+        size_t lane = static_cast<size_t>(
+            std::find(rowOrder.begin() + windowBegin, rowOrder.begin() + windowEnd, i) - rowOrder.begin());
+        size_t k = lane / chunkSize;
+        size_t r = lane % chunkSize;
+        size_t width = (chunkPtr[k + 1] - chunkPtr[k]) / chunkSize;
+        for(size_t c = 0; c < width; ++c) {
+            size_t slot = chunkPtr[k] + c * chunkSize + r;
+            if(colIndex[slot] == j && values[slot] != T())
+                return values[slot];
+        }
+        return T();
+    }
+
+    // y = A * x - yaygın chunk genişlikleri sabit boyutlu çekirdeklere yönlendirilir
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        if(x.size() != cols)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        std::vector<T> y(rows, T());
+        if(chunkSize == 4) multiplyFixed<4>(x.data(), y.data());
+        else if(chunkSize == 8) multiplyFixed<8>(x.data(), y.data());
+        else if(chunkSize == 16) multiplyFixed<16>(x.data(), y.data());
+        else multiplyGeneric(x.data(), y.data());
+        return y;
+    }
+};
+
+// Auto-tuner: matrix yapısından SpMV başına taşınan byte'ı tahmin edip en ucuz formatı seçer
+enum class SparseFormat {
+    CSR,
+    BSR,
+    SELL
+};
+
+struct SparseFormatChoice {
+    SparseFormat format = SparseFormat::CSR;
+    size_t blockRows = 1;
+    size_t blockCols = 1;
+    size_t chunkSize = 0;
+    size_t sigma = 0;
+    double fillRatio = 1.0;       // seçilen formatta saklanan / nnz
+    double estimatedBytes = 0;    // seçilen format için SpMV başına tahmini trafik
+    double csrBytes = 0;          // CSR için aynı tahmin
+
+    std::string describe() const {
+        std::ostringstream out;
+        switch(format) {
+            case SparseFormat::CSR:
+                out << "CSR";
+                break;
+            case SparseFormat::BSR:
+                out << "BSR " << blockRows << "x" << blockCols;
+                break;
+            case SparseFormat::SELL:
+                out << "SELL-" << chunkSize << "-" << sigma;
+                break;
+        }
+        out << " (fill " << fillRatio << ", ~" << estimatedBytes / 1e6 << " MB/SpMV, CSR ~"
+            << csrBytes / 1e6 << " MB)";
+        return out.str();
+    }
+};
+
+// Kısa satırlarda CSR'ın satır başına döngü/dallanma maliyeti byte cinsinden bir ceza olarak eklenir
+constexpr double CSR_ROW_OVERHEAD_BYTES = 32.0;
+// Seçimin CSR'dan ayrılması için gereken minimum kazanç
+constexpr double FORMAT_SWITCH_GAIN = 0.9;
+
+template<typename T>
+SparseFormatChoice chooseSparseFormat(const CSRMatrix<T>& a) {
+    const auto& ptr = a.getRowPointers();
+    const auto& idx = a.getColumnIndices();
+    size_t rows = a.getRows();
+    double nnz = static_cast<double>(a.getNonZeroCount());
+    double valueBytes = sizeof(T);
+    double indexBytes = sizeof(size_t);
+
+    SparseFormatChoice best;
+    best.csrBytes = nnz * (valueBytes + indexBytes) + rows * (indexBytes + valueBytes + CSR_ROW_OVERHEAD_BYTES);
+    best.estimatedBytes = best.csrBytes;
+    if(nnz == 0)
+        return best;
+    double threshold = best.csrBytes * FORMAT_SWITCH_GAIN;
+
+    // BSR adayları: blok sayısı marker dizisiyle O(nnz) sayılır
+    const size_t blockSizes[] = {2, 3, 4, 8};
+    const size_t none = static_cast<size_t>(-1);
+    for(size_t bs : blockSizes) {
+        size_t nbr = (rows + bs - 1) / bs;
+        std::vector<size_t> mark((a.getCols() + bs - 1) / bs, none);
+        size_t blocks = 0;
+        for(size_t b = 0; b < nbr; ++b)
+            for(size_t i = b * bs; i < std::min(rows, (b + 1) * bs); ++i)
+                for(size_t p = ptr[i]; p < ptr[i + 1]; ++p)
+                    if(mark[idx[p] / bs] != b) {
+                        mark[idx[p] / bs] = b;
+                        ++blocks;
+                    }
+        double fill = static_cast<double>(blocks * bs * bs) / nnz;
+        double bytes = blocks * (bs * bs * valueBytes + indexBytes) + nbr * (indexBytes + bs * valueBytes);
+        if(bytes < threshold && bytes < best.estimatedBytes) {
+            best.format = SparseFormat::BSR;
+            best.blockRows = best.blockCols = bs;
+            best.chunkSize = best.sigma = 0;
+            best.fillRatio = fill;
+            best.estimatedBytes = bytes;
+        }
+    }
+
+    // SELL adayları: σ pencereleri içinde sıralı satır uzunluklarından padding hesaplanır
+    const size_t chunk = 8;
+    const size_t sigmas[] = {chunk, 32 * chunk, 256 * chunk};
+    std::vector<size_t> lengths(rows);
+    for(size_t sigma : sigmas) {
+        for(size_t i = 0; i < rows; ++i)
+            lengths[i] = ptr[i + 1] - ptr[i];
+        for(size_t w = 0; w < rows; w += sigma)
+            std::sort(lengths.begin() + w, lengths.begin() + std::min(w + sigma, rows), std::greater<size_t>());
+        size_t slots = 0;
+        for(size_t k = 0; k < rows; k += chunk)
+            slots += lengths[k] * chunk;  // chunk'ın ilk satırı en uzunudur
+        double fill = static_cast<double>(slots) / nnz;
+        double bytes = slots * (valueBytes + indexBytes) + rows * (indexBytes + valueBytes);
+        if(bytes < threshold && bytes < best.estimatedBytes) {
+            best.format = SparseFormat::SELL;
+            best.blockRows = best.blockCols = 1;
+            best.chunkSize = chunk;
+            best.sigma = sigma;
+            best.fillRatio = fill;
+            best.estimatedBytes = bytes;
+        }
+    }
+    return best;
+}
+
+// Auto-tuner'ın seçtiği formatta saklanan matrix; SpMV seçilen çekirdeğe statik olarak yönlendirilir
+template<typename T>
+class TunedSparseMatrix {
+private:
+    std::variant<CSRMatrix<T>, BSRMatrix<T>, SELLMatrix<T>> storage;
+    SparseFormatChoice choice;
+
+    TunedSparseMatrix(std::variant<CSRMatrix<T>, BSRMatrix<T>, SELLMatrix<T>> s, SparseFormatChoice c)
+        : storage(std::move(s)), choice(c) {}
+
+public:
+    static TunedSparseMatrix fromCSR(const CSRMatrix<T>& a) {
+        SparseFormatChoice c = chooseSparseFormat(a);
+        switch(c.format) {
+            case SparseFormat::BSR:
+                return TunedSparseMatrix(BSRMatrix<T>::fromCSR(a, c.blockRows, c.blockCols), c);
+            case SparseFormat::SELL:
+                return TunedSparseMatrix(SELLMatrix<T>::fromCSR(a, c.chunkSize, c.sigma), c);
+            default:
+                return TunedSparseMatrix(a, c);
+        }
+    }
+
+    static TunedSparseMatrix fromCOO(const SparseMatrix<T>& coo) {
+        return fromCSR(CSRMatrix<T>::fromCOO(coo));
+    }
+
+    const SparseFormatChoice& getChoice() const { return choice; }
+
+    T get(size_t i, size_t j) const {
+        return std::visit([&](const auto& m) { return m.get(i, j); }, storage);
+    }
+
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        return std::visit([&](const auto& m) { return m.multiply(x); }, storage);
+    }
+};
+
+#endif // BLOCKED_SPARSE_H
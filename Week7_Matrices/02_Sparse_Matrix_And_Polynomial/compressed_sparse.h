@@ -0,0 +1,560 @@
+#ifndef COMPRESSED_SPARSE_H
+#define COMPRESSED_SPARSE_H
+
+#include "sparse_matrix.h"
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+
+// COO elementlerini (major, minor) sırasına dizip sıkıştırır - iki geçişli counting sort, O(nnz + nMajor + nMinor)
+// CSR için major = satır, CSC için major = sütun. Aynı konumdaki tekrarlar için SparseMatrix::get ile
+// tutarlı olarak ilk eklenen değer tutulur.
+template<typename T, typename MajorOf, typename MinorOf>
+void compressElements(const std::vector<Element<T>>& elements, size_t nMajor, size_t nMinor,
+                      MajorOf majorOf, MinorOf minorOf,
+                      std::vector<size_t>& ptr, std::vector<size_t>& index, std::vector<T>& values) {
+    size_t nnz = elements.size();
+
+    // 1. geçiş: minor anahtara göre stable sıralama (sadece permütasyon)
+    std::vector<size_t> minorStart(nMinor + 1, 0);
+    for(const auto& e : elements)
+        ++minorStart[minorOf(e) + 1];
+    for(size_t k = 0; k < nMinor; ++k)
+        minorStart[k + 1] += minorStart[k];
+    std::vector<size_t> order(nnz);
+    for(size_t p = 0; p < nnz; ++p)
+        order[minorStart[minorOf(elements[p])]++] = p;
+
+    // 2. geçiş: major anahtara göre stable sıralama -> satır/sütun içinde minor sıralı
+    ptr.assign(nMajor + 1, 0);
+    for(const auto& e : elements)
+        ++ptr[majorOf(e) + 1];
+    for(size_t k = 0; k < nMajor; ++k)
+        ptr[k + 1] += ptr[k];
+    index.resize(nnz);
+    values.resize(nnz);
+    std::vector<size_t> next(ptr.begin(), ptr.end() - 1);
+    for(size_t p : order) {
+        const Element<T>& e = elements[p];
+        size_t dst = next[majorOf(e)]++;
+        index[dst] = minorOf(e);
+        values[dst] = e.value;
+    }
+
+    // Tekrarları birleştir: eşit minor değerlerinden ilki (ilk eklenen) kalır
+    size_t write = 0;
+    size_t begin = 0;
+    for(size_t m = 0; m < nMajor; ++m) {
+        size_t end = ptr[m + 1];
+        for(size_t p = begin; p < end; ++p) {
+            if(p > begin && index[p] == index[p - 1])
+                continue;
+            index[write] = index[p];
+            values[write] = values[p];
+            ++write;
+        }
+        begin = end;
+        ptr[m + 1] = write;
+    }
+    index.resize(write);
+    values.resize(write);
+}
+
+// [0, count) aralığını nnz'ye göre dengeli parçalara bölen sınırlar
+// ptr: CSR rowPtr / CSC colPtr, parts: parça sayısı
+inline std::vector<size_t> balancedPartition(const std::vector<size_t>& ptr, size_t parts) {
+    size_t count = ptr.size() - 1;
+    size_t nnz = ptr.back();
+    std::vector<size_t> bounds(parts + 1, count);
+    bounds[0] = 0;
+    for(size_t t = 1; t < parts; ++t) {
+        size_t target = (nnz * t) / parts;
+        size_t pos = std::lower_bound(ptr.begin(), ptr.end(), target) - ptr.begin();
+        bounds[t] = std::max(bounds[t - 1], std::min(pos, count));
+    }
+    return bounds;
+}
+
+// [begin, end) aralıklarını threadCount thread'e dağıtıp f(begin, end) çağırır
+template<typename F>
+void runPartitioned(const std::vector<size_t>& bounds, F f) {
+    size_t parts = bounds.size() - 1;
+    std::vector<std::thread> workers;
+    workers.reserve(parts);
+    for(size_t t = 1; t < parts; ++t)
+        workers.emplace_back(f, bounds[t], bounds[t + 1]);
+    f(bounds[0], bounds[1]);  // İlk parçayı çağıran thread işler
+    for(auto& w : workers)
+        w.join();
+}
+
+inline size_t defaultThreadCount() {
+    size_t n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+}
+
+template<typename T>
+class CSCMatrix;
+
+// SpGEMM (sparse x sparse) satır akümülatörü
+enum class SpGEMMAccumulator {
+    Dense,  // cols uzunluğunda dizi + marker (SPA) - yoğun sonuç satırları için
+    Hash    // Satırın iş yüküne göre boyutlanan open addressing tablo - çok geniş matrix'ler için
+};
+
+// Gustavson çarpımı için thread başına çalışma alanı
+template<typename T>
+class SpGEMMWorkspace {
+private:
+    static constexpr size_t EMPTY = static_cast<size_t>(-1);
+
+    std::vector<T> denseValues;
+    std::vector<size_t> denseMarker;   // denseMarker[j] == satır -> j bu satırda dolu
+    std::vector<size_t> hashKeys;
+    std::vector<T> hashValues;
+    std::vector<size_t> touched;
+    std::vector<std::pair<size_t, T>> rowEntries;
+
+public:
+    // C'nin i. satırını hesaplar: C[i,:] = sum_p A[i,p] * B[p,:]
+    // Sonuç sütun sırasına göre sıralı olarak outIndex / outValues'a eklenir
+    void computeRow(size_t i, const std::vector<size_t>& aPtr, const std::vector<size_t>& aIdx,
+                    const std::vector<T>& aVal, const std::vector<size_t>& bPtr,
+                    const std::vector<size_t>& bIdx, const std::vector<T>& bVal, size_t bCols,
+                    SpGEMMAccumulator mode, std::vector<size_t>& outIndex, std::vector<T>& outValues) {
+        touched.clear();
+        if(mode == SpGEMMAccumulator::Dense) {
+            if(denseMarker.size() != bCols) {
+                denseValues.assign(bCols, T());
+                denseMarker.assign(bCols, EMPTY);
+            }
+            for(size_t p = aPtr[i]; p < aPtr[i + 1]; ++p) {
+                size_t k = aIdx[p];
+                T a = aVal[p];
+                for(size_t q = bPtr[k]; q < bPtr[k + 1]; ++q) {
+                    size_t j = bIdx[q];
+                    if(denseMarker[j] != i) {
+                        denseMarker[j] = i;
+                        denseValues[j] = a * bVal[q];
+                        touched.push_back(j);
+                    } else {
+                        denseValues[j] += a * bVal[q];
+                    }
+                }
+            }
+            std::sort(touched.begin(), touched.end());
+            for(size_t j : touched) {
+                if(denseValues[j] != T()) {
+                    outIndex.push_back(j);
+                    outValues.push_back(denseValues[j]);
+                }
+            }
+            return;
+        }
+
+        // Hash: tablo boyutu satırın üst sınır iş yükünün iki katı (2'nin kuvveti)
+        size_t work = 0;
+        for(size_t p = aPtr[i]; p < aPtr[i + 1]; ++p)
+            work += bPtr[aIdx[p] + 1] - bPtr[aIdx[p]];
+        size_t capacity = 16;
+        while(capacity < 2 * work)
+            capacity <<= 1;
+        if(hashKeys.size() < capacity) {
+            hashKeys.assign(capacity, EMPTY);
+            hashValues.assign(capacity, T());
+        }
+        size_t mask = capacity - 1;
+        for(size_t p = aPtr[i]; p < aPtr[i + 1]; ++p) {
+            size_t k = aIdx[p];
+            T a = aVal[p];
+            for(size_t q = bPtr[k]; q < bPtr[k + 1]; ++q) {
+                size_t j = bIdx[q];
+                size_t h = (j * 0x9E3779B97F4A7C15ull) & mask;
+                while(hashKeys[h] != EMPTY && hashKeys[h] != j)
+                    h = (h + 1) & mask;
+                if(hashKeys[h] == EMPTY) {
+                    hashKeys[h] = j;
+                    hashValues[h] = a * bVal[q];
+                    touched.push_back(h);
+                } else {
+                    hashValues[h] += a * bVal[q];
+                }
+            }
+        }
+        rowEntries.clear();
+        for(size_t h : touched) {
+            if(hashValues[h] != T())
+                rowEntries.emplace_back(hashKeys[h], hashValues[h]);
+            hashKeys[h] = EMPTY;  // Sadece kullanılan slotları temizle
+        }
+        std::sort(rowEntries.begin(), rowEntries.end(),
+                  [](const auto& l, const auto& r) { return l.first < r.first; });
+        for(const auto& entry : rowEntries) {
+            outIndex.push_back(entry.first);
+            outValues.push_back(entry.second);
+        }
+    }
+};
+
+// Compressed Sparse Row (CSR) matrix
+// rowPtr[i]..rowPtr[i+1] aralığı i. satırın elementleridir; satır içinde sütunlar sıralıdır
+template<typename T>
+class CSRMatrix {
+private:
+    size_t rows;
+    size_t cols;
+    std::vector<size_t> rowPtr;    // rows + 1 eleman
+    std::vector<size_t> colIndex;  // nnz eleman
+    std::vector<T> values;         // nnz eleman
+
+public:
+    // Boş (tamamen sıfır) matrix
+    CSRMatrix(size_t r, size_t c) : rows(r), cols(c), rowPtr(r + 1, 0) {}
+
+    // Hazır CSR dizilerinden oluşturma
+    CSRMatrix(size_t r, size_t c, std::vector<size_t> ptr, std::vector<size_t> index, std::vector<T> vals)
+        : rows(r), cols(c), rowPtr(std::move(ptr)), colIndex(std::move(index)), values(std::move(vals)) {
+        if(rowPtr.size() != rows + 1 || colIndex.size() != values.size() || rowPtr.back() != values.size())
+            throw std::invalid_argument("Invalid CSR arrays");
+    }
+
+    // COO -> CSR dönüşümü - counting sort ile O(nnz + rows + cols)
+    static CSRMatrix fromCOO(const SparseMatrix<T>& coo) {
+        CSRMatrix result(coo.getRows(), coo.getCols());
+        compressElements(coo.getElements(), coo.getRows(), coo.getCols(),
+                         [](const Element<T>& e) { return e.row; },
+                         [](const Element<T>& e) { return e.col; },
+                         result.rowPtr, result.colIndex, result.values);
+        return result;
+    }
+
+    size_t getRows() const { return rows; }
+    size_t getCols() const { return cols; }
+    size_t getNonZeroCount() const { return values.size(); }
+
+    const std::vector<size_t>& getRowPointers() const { return rowPtr; }
+    const std::vector<size_t>& getColumnIndices() const { return colIndex; }
+    const std::vector<T>& getValues() const { return values; }
+
+    // Element alma - satır içinde binary search, O(log k)
+    T get(size_t i, size_t j) const {
+        if(i >= rows || j >= cols)
+            throw std::out_of_range("Index out of range");
+        auto first = colIndex.begin() + rowPtr[i];
+        auto last = colIndex.begin() + rowPtr[i + 1];
+        auto it = std::lower_bound(first, last, j);
+        if(it != last && *it == j)
+            return values[it - colIndex.begin()];
+        return T();
+    }
+
+    // y = A * x - satır bazlı dot product
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        if(x.size() != cols)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        std::vector<T> y(rows);
+        multiplyRows(x, y, 0, rows);
+        return y;
+    }
+
+    // y = A * x - satırlar nnz'ye göre dengeli parçalara bölünüp thread'lerde hesaplanır
+    std::vector<T> multiplyParallel(const std::vector<T>& x, size_t threadCount = defaultThreadCount()) const {
+        std::vector<T> y(rows);
+        multiplyInto(x, y, threadCount);
+        return y;
+    }
+
+    // y = A * x - sonuç mevcut vektöre yazılır (iteratif çözücülerde tekrar eden allocation'ı önler)
+    void multiplyInto(const std::vector<T>& x, std::vector<T>& y, size_t threadCount = 1) const {
+        if(x.size() != cols)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        y.resize(rows);
+        if(threadCount <= 1 || rows == 0) {
+            multiplyRows(x, y, 0, rows);
+            return;
+        }
+        runPartitioned(balancedPartition(rowPtr, threadCount),
+                       [&](size_t begin, size_t end) { multiplyRows(x, y, begin, end); });
+    }
+
+    // y = A^T * x - satırlar gezilip sonuç sütunlara dağıtılır (scatter)
+    std::vector<T> multiplyTransposed(const std::vector<T>& x) const {
+        if(x.size() != rows)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        std::vector<T> y(cols, T());
+        for(size_t i = 0; i < rows; ++i)
+            for(size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                y[colIndex[p]] += values[p] * x[i];
+        return y;
+    }
+
+    // A^T - counting sort ile O(nnz + cols); sonuçta sütunlar yine sıralı kalır
+    CSRMatrix transpose() const {
+        std::vector<size_t> ptr(cols + 1, 0);
+        for(size_t j : colIndex)
+            ++ptr[j + 1];
+        for(size_t j = 0; j < cols; ++j)
+            ptr[j + 1] += ptr[j];
+
+        std::vector<size_t> index(values.size());
+        std::vector<T> vals(values.size());
+        std::vector<size_t> next(ptr.begin(), ptr.end() - 1);
+        for(size_t i = 0; i < rows; ++i)
+            for(size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p) {
+                size_t dst = next[colIndex[p]]++;
+                index[dst] = i;
+                vals[dst] = values[p];
+            }
+        return CSRMatrix(cols, rows, std::move(ptr), std::move(index), std::move(vals));
+    }
+
+    // A + B - her satırda sıralı sütun listelerinin merge'ü, O(nnz(A) + nnz(B))
+    // Toplamı sıfır olan elementler sonuca eklenmez
+    CSRMatrix add(const CSRMatrix& other) const {
+        if(rows != other.rows || cols != other.cols)
+            throw std::invalid_argument("Matrix dimensions do not match");
+        std::vector<size_t> ptr(rows + 1, 0);
+        std::vector<size_t> index;
+        std::vector<T> vals;
+        index.reserve(values.size() + other.values.size());
+        vals.reserve(values.size() + other.values.size());
+        
+        for(size_t i = 0; i < rows; ++i) {
+            size_t p = rowPtr[i], pEnd = rowPtr[i + 1];
+            size_t q = other.rowPtr[i], qEnd = other.rowPtr[i + 1];
+            while(p < pEnd || q < qEnd) {
+                size_t j;
+                T sum;
+                if(q == qEnd || (p < pEnd && colIndex[p] < other.colIndex[q])) {
+                    j = colIndex[p];
+                    sum = values[p++];
+                } else if(p == pEnd || other.colIndex[q] < colIndex[p]) {
+                    j = other.colIndex[q];
+                    sum = other.values[q++];
+                } else {
+                    j = colIndex[p];
+                    sum = values[p++] + other.values[q++];
+                }
+                if(sum != T()) {
+                    index.push_back(j);
+                    vals.push_back(sum);
+                }
+            }
+            ptr[i + 1] = index.size();
+        }
+        return CSRMatrix(rows, cols, std::move(ptr), std::move(index), std::move(vals));
+    }
+    
+    // A * B - Gustavson algoritması (satır satır), O(flops + nnz(C) log)
+    CSRMatrix multiply(const CSRMatrix& other, SpGEMMAccumulator mode = SpGEMMAccumulator::Dense) const {
+        if(cols != other.rows)
+            throw std::invalid_argument("Matrix dimensions do not match");
+        std::vector<size_t> ptr(rows + 1, 0);
+        std::vector<size_t> index;
+        std::vector<T> vals;
+        SpGEMMWorkspace<T> workspace;
+        for(size_t i = 0; i < rows; ++i) {
+            workspace.computeRow(i, rowPtr, colIndex, values, other.rowPtr, other.colIndex,
+                                 other.values, other.cols, mode, index, vals);
+            ptr[i + 1] = index.size();
+        }
+        return CSRMatrix(rows, other.cols, std::move(ptr), std::move(index), std::move(vals));
+    }
+    
+    // A * B - satırlar çarpım iş yüküne (flops) göre dengeli thread'lere bölünür.
+    // Her thread kendi satır bloğunu yerel dizilere yazar, sonunda bloklar sırayla birleştirilir.
+    CSRMatrix multiplyParallel(const CSRMatrix& other, size_t threadCount = defaultThreadCount(),
+                               SpGEMMAccumulator mode = SpGEMMAccumulator::Dense) const {
+        if(cols != other.rows)
+            throw std::invalid_argument("Matrix dimensions do not match");
+        if(threadCount <= 1 || rows == 0)
+            return multiply(other, mode);
+        
+        // Satır başına flops'un prefix toplamı
+        std::vector<size_t> flops(rows + 1, 0);
+        for(size_t i = 0; i < rows; ++i) {
+            size_t work = 0;
+            for(size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                work += other.rowPtr[colIndex[p] + 1] - other.rowPtr[colIndex[p]];
+            flops[i + 1] = flops[i] + work;
+        }
+        std::vector<size_t> bounds = balancedPartition(flops, threadCount);
+        size_t parts = bounds.size() - 1;
+        
+        std::vector<std::vector<size_t>> partIndex(parts), partCounts(parts);
+        std::vector<std::vector<T>> partValues(parts);
+        auto work = [&](size_t begin, size_t end) {
+            size_t part = std::upper_bound(bounds.begin(), bounds.end(), begin) - bounds.begin() - 1;
+            SpGEMMWorkspace<T> workspace;
+            for(size_t i = begin; i < end; ++i) {
+                size_t before = partIndex[part].size();
+                workspace.computeRow(i, rowPtr, colIndex, values, other.rowPtr, other.colIndex,
+                                     other.values, other.cols, mode, partIndex[part], partValues[part]);
+                partCounts[part].push_back(partIndex[part].size() - before);
+            }
+        };
+        runPartitioned(bounds, work);
+        
+        std::vector<size_t> ptr(rows + 1, 0);
+        std::vector<size_t> index;
+        std::vector<T> vals;
+        size_t row = 0;
+        for(size_t t = 0; t < parts; ++t) {
+            for(size_t count : partCounts[t]) {
+                ptr[row + 1] = ptr[row] + count;
+                ++row;
+            }
+            index.insert(index.end(), partIndex[t].begin(), partIndex[t].end());
+            vals.insert(vals.end(), partValues[t].begin(), partValues[t].end());
+        }
+        return CSRMatrix(rows, other.cols, std::move(ptr), std::move(index), std::move(vals));
+    }
+    
+    // CSC(A) dizileri CSR(A^T) ile aynıdır
+    CSCMatrix<T> toCSC() const;
+
+    SparseMatrix<T> toCOO() const {
+        SparseMatrix<T> coo(rows, cols);
+        for(size_t i = 0; i < rows; ++i)
+            for(size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                coo.addElement(i, colIndex[p], values[p]);
+        return coo;
+    }
+
+private:
+    void multiplyRows(const std::vector<T>& x, std::vector<T>& y, size_t begin, size_t end) const {
+        const size_t* ptr = rowPtr.data();
+        const size_t* idx = colIndex.data();
+        const T* val = values.data();
+        for(size_t i = begin; i < end; ++i) {
+            T sum = T();
+            for(size_t p = ptr[i]; p < ptr[i + 1]; ++p)
+                sum += val[p] * x[idx[p]];
+            y[i] = sum;
+        }
+    }
+};
+
+// Compressed Sparse Column (CSC) matrix
+// colPtr[j]..colPtr[j+1] aralığı j. sütunun elementleridir; sütun içinde satırlar sıralıdır
+template<typename T>
+class CSCMatrix {
+private:
+    size_t rows;
+    size_t cols;
+    std::vector<size_t> colPtr;    // cols + 1 eleman
+    std::vector<size_t> rowIndex;  // nnz eleman
+    std::vector<T> values;         // nnz eleman
+
+public:
+    CSCMatrix(size_t r, size_t c) : rows(r), cols(c), colPtr(c + 1, 0) {}
+
+    CSCMatrix(size_t r, size_t c, std::vector<size_t> ptr, std::vector<size_t> index, std::vector<T> vals)
+        : rows(r), cols(c), colPtr(std::move(ptr)), rowIndex(std::move(index)), values(std::move(vals)) {
+        if(colPtr.size() != cols + 1 || rowIndex.size() != values.size() || colPtr.back() != values.size())
+            throw std::invalid_argument("Invalid CSC arrays");
+    }
+
+    // COO -> CSC dönüşümü - counting sort ile O(nnz + rows + cols)
+    static CSCMatrix fromCOO(const SparseMatrix<T>& coo) {
+        CSCMatrix result(coo.getRows(), coo.getCols());
+        compressElements(coo.getElements(), coo.getCols(), coo.getRows(),
+                         [](const Element<T>& e) { return e.col; },
+                         [](const Element<T>& e) { return e.row; },
+                         result.colPtr, result.rowIndex, result.values);
+        return result;
+    }
+
+    size_t getRows() const { return rows; }
+    size_t getCols() const { return cols; }
+    size_t getNonZeroCount() const { return values.size(); }
+
+    const std::vector<size_t>& getColumnPointers() const { return colPtr; }
+    const std::vector<size_t>& getRowIndices() const { return rowIndex; }
+    const std::vector<T>& getValues() const { return values; }
+
+    // Element alma - sütun içinde binary search, O(log k)
+    T get(size_t i, size_t j) const {
+        if(i >= rows || j >= cols)
+            throw std::out_of_range("Index out of range");
+        auto first = rowIndex.begin() + colPtr[j];
+        auto last = rowIndex.begin() + colPtr[j + 1];
+        auto it = std::lower_bound(first, last, i);
+        if(it != last && *it == i)
+            return values[it - rowIndex.begin()];
+        return T();
+    }
+
+    // y = A * x - sütun bazlı axpy (scatter)
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        if(x.size() != cols)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        std::vector<T> y(rows, T());
+        for(size_t j = 0; j < cols; ++j) {
+            T xj = x[j];
+            for(size_t p = colPtr[j]; p < colPtr[j + 1]; ++p)
+                y[rowIndex[p]] += values[p] * xj;
+        }
+        return y;
+    }
+
+    // y = A^T * x - sütun bazlı dot product, sütunlar nnz'ye göre dengeli thread'lere bölünür
+    std::vector<T> multiplyTransposed(const std::vector<T>& x, size_t threadCount = 1) const {
+        if(x.size() != rows)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        std::vector<T> y(cols);
+        auto work = [&](size_t begin, size_t end) {
+            for(size_t j = begin; j < end; ++j) {
+                T sum = T();
+                for(size_t p = colPtr[j]; p < colPtr[j + 1]; ++p)
+                    sum += values[p] * x[rowIndex[p]];
+                y[j] = sum;
+            }
+        };
+        if(threadCount <= 1 || cols == 0)
+            work(0, cols);
+        else
+            runPartitioned(balancedPartition(colPtr, threadCount), work);
+        return y;
+    }
+
+    // A^T - CSC(A^T) dizileri CSR(A) dizileri ile aynıdır
+    CSCMatrix transpose() const {
+        CSRMatrix<T> asRowsOfTranspose(cols, rows, colPtr, rowIndex, values);
+        CSRMatrix<T> t = asRowsOfTranspose.transpose();  // = CSR(A)
+        return CSCMatrix(cols, rows, t.getRowPointers(), t.getColumnIndices(), t.getValues());
+    }
+
+    CSRMatrix<T> toCSR() const {
+        // CSC(A) == CSR(A^T); transpozu alınca CSR(A) elde edilir
+        return CSRMatrix<T>(cols, rows, colPtr, rowIndex, values).transpose();
+    }
+
+    SparseMatrix<T> toCOO() const {
+        SparseMatrix<T> coo(rows, cols);
+        for(size_t j = 0; j < cols; ++j)
+            for(size_t p = colPtr[j]; p < colPtr[j + 1]; ++p)
+                coo.addElement(rowIndex[p], j, values[p]);
+        return coo;
+    }
+};
+
+template<typename T>
+CSCMatrix<T> CSRMatrix<T>::toCSC() const {
+    CSRMatrix<T> t = transpose();  // CSR(A^T)
+    return CSCMatrix<T>(rows, cols, t.getRowPointers(), t.getColumnIndices(), t.getValues());
+}
+
+// COO matrix'ler için aritmetik - hesaplama CSR üzerinden yapılır, sonuç (satır, sütun) sıralı COO'dur
+template<typename T>
+SparseMatrix<T> operator+(const SparseMatrix<T>& a, const SparseMatrix<T>& b) {
+    return CSRMatrix<T>::fromCOO(a).add(CSRMatrix<T>::fromCOO(b)).toCOO();
+}
+
+template<typename T>
+SparseMatrix<T> operator*(const SparseMatrix<T>& a, const SparseMatrix<T>& b) {
+    return CSRMatrix<T>::fromCOO(a).multiply(CSRMatrix<T>::fromCOO(b)).toCOO();
+}
+
+#endif // COMPRESSED_SPARSE_H
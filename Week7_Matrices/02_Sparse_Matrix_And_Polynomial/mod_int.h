@@ -0,0 +1,81 @@
+#ifndef MOD_INT_H
+#define MOD_INT_H
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+// Z/p katsayıları: P asal olmalı (bölme Fermat ile ters alarak yapılır).
+// Polynomial<ModInt<P>> ile tüm polinom işlemleri mod p'de tamdır.
+template<uint32_t P>
+class ModInt {
+private:
+    uint32_t v;
+
+public:
+    static_assert(P >= 2 && P < (1u << 31), "Modulus must fit in 31 bits");
+
+    ModInt() : v(0) {}
+    ModInt(long long x) {
+        long long r = x % static_cast<long long>(P);
+        v = static_cast<uint32_t>(r < 0 ? r + P : r);
+    }
+
+    static constexpr uint32_t modulus() { return P; }
+    uint32_t value() const { return v; }
+
+    ModInt& operator+=(const ModInt& o) {
+        v += o.v;
+        if(v >= P) v -= P;
+        return *this;
+    }
+    ModInt& operator-=(const ModInt& o) {
+        v = v >= o.v ? v - o.v : v + P - o.v;
+        return *this;
+    }
+    ModInt& operator*=(const ModInt& o) {
+        v = static_cast<uint32_t>(static_cast<uint64_t>(v) * o.v % P);
+        return *this;
+    }
+    ModInt& operator/=(const ModInt& o) { return *this *= o.inverse(); }
+
+    friend ModInt operator+(ModInt a, const ModInt& b) { return a += b; }
+    friend ModInt operator-(ModInt a, const ModInt& b) { return a -= b; }
+    friend ModInt operator*(ModInt a, const ModInt& b) { return a *= b; }
+    friend ModInt operator/(ModInt a, const ModInt& b) { return a /= b; }
+    ModInt operator-() const { return ModInt() - *this; }
+
+    friend bool operator==(const ModInt& a, const ModInt& b) { return a.v == b.v; }
+    friend bool operator!=(const ModInt& a, const ModInt& b) { return a.v != b.v; }
+    // Sıralama yalnızca temsilci değere göredir (display ve sıralı kaplar için)
+    friend bool operator<(const ModInt& a, const ModInt& b) { return a.v < b.v; }
+    friend bool operator>(const ModInt& a, const ModInt& b) { return a.v > b.v; }
+
+    ModInt pow(uint64_t e) const {
+        ModInt base = *this, result = 1;
+        while(e) {
+            if(e & 1) result *= base;
+            base *= base;
+            e >>= 1;
+        }
+        return result;
+    }
+
+    // a^{p-2} = a^{-1} (Fermat)
+    ModInt inverse() const {
+        if(v == 0)
+            throw std::invalid_argument("Division by zero");
+        return pow(P - 2);
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const ModInt& a) { return out << a.v; }
+};
+
+template<typename T>
+struct IsModInt : std::false_type {};
+
+template<uint32_t P>
+struct IsModInt<ModInt<P>> : std::true_type {};
+
+#endif // MOD_INT_H
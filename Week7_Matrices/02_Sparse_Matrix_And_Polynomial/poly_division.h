@@ -0,0 +1,218 @@
+#ifndef POLY_DIVISION_H
+#define POLY_DIVISION_H
+
+#include "poly_multiply.h"
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+// Yoğun katsayı vektörleri üzerinde bölme, gcd ve modüler üs alma çekirdekleri.
+// Büyük boyutlarda bölme, Newton iterasyonuyla bulunan kuvvet serisi tersi ve multiplyDense
+// üzerinden O(M(n)) maliyetle yapılır.
+
+// Bölüm uzunluğu bu eşiğin altındaysa klasik long division daha hızlıdır
+// (mod 998244353, 2n / n bölme: n = 640'ta long division, n = 768'de Newton önde)
+constexpr size_t NEWTON_DIVISION_THRESHOLD = 700;
+
+namespace poly_detail {
+
+// Sondaki sıfır katsayıları kırpar
+template<typename T>
+void trim(std::vector<T>& a) {
+    while(!a.empty() && a.back() == T())
+        a.pop_back();
+}
+
+// c^{-1}; tamsayı tiplerinde yalnızca ±1 terslenebilir, diğerleri için istisna atılır
+template<typename T>
+T invertCoefficient(const T& c) {
+    if(c == T())
+        throw std::invalid_argument("Division by zero");
+    T inv = T(1) / c;
+    if constexpr(!std::is_floating_point<T>::value)
+        if(inv * c != T(1))
+            throw std::invalid_argument("Leading coefficient is not invertible");
+    return inv;
+}
+
+} // namespace poly_detail
+
+// a^{-1} mod x^n, a[0] terslenebilir olmalı (tamsayılarda ±1; cisimlerde sıfırdan farklı).
+// Newton: g_{2k} = g_k (2 - a g_k) mod x^{2k} - her adım iki çarpım, toplam O(M(n))
+template<typename T>
+std::vector<T> inverseSeries(const std::vector<T>& a, size_t n) {
+    if(a.empty() || a[0] == T())
+        throw std::invalid_argument("Series inverse requires nonzero constant term");
+    std::vector<T> g = {poly_detail::invertCoefficient(a[0])};
+    size_t k = 1;
+    while(k < n) {
+        k = std::min(2 * k, n);
+        std::vector<T> head(a.begin(), a.begin() + std::min(a.size(), k));
+        std::vector<T> e = multiplyDense(head, g);  // a g = 1 + x^{k/2}(...)
+        e.resize(k, T());
+        for(auto& c : e)
+            c = -c;
+        e[0] += T(2);
+        g = multiplyDense(g, e);
+        g.resize(k, T());
+    }
+    g.resize(n, T());
+    return g;
+}
+
+template<typename T>
+struct PolyDivisionResult {
+    std::vector<T> quotient;
+    std::vector<T> remainder;
+};
+
+// a = b q + r, deg r < deg b. Baş katsayı terslenebilir olmalı (cisimler: double, ModInt;
+// tamsayılarda yalnızca ±1). Kısa bölümde long division O(nm), uzun bölümde
+// rev(q) = rev(a) rev(b)^{-1} mod x^{n-m} ile Newton bölmesi O(M(n)).
+template<typename T>
+PolyDivisionResult<T> divideDense(std::vector<T> a, std::vector<T> b) {
+    poly_detail::trim(a);
+    poly_detail::trim(b);
+    if(b.empty())
+        throw std::invalid_argument("Division by zero polynomial");
+    T leadInv = poly_detail::invertCoefficient(b.back());
+    size_t m = b.size() - 1;  // bölen derecesi
+    if(a.size() <= m)
+        return {{}, std::move(a)};
+    size_t quotientSize = a.size() - m;
+    PolyDivisionResult<T> result;
+
+    if(quotientSize < NEWTON_DIVISION_THRESHOLD || m < KARATSUBA_THRESHOLD) {
+        result.quotient.assign(quotientSize, T());
+        for(size_t i = a.size(); i-- > m;) {
+            T q = a[i] * leadInv;
+            result.quotient[i - m] = q;
+            if(q == T())
+                continue;
+            for(size_t j = 0; j <= m; ++j)
+                a[i - m + j] -= q * b[j];
+        }
+        a.resize(m);
+        result.remainder = std::move(a);
+    } else {
+        std::vector<T> revA(a.rbegin(), a.rbegin() + quotientSize);
+        std::vector<T> revB(b.rbegin(), b.rend());
+        std::vector<T> revQ = multiplyDense(revA, inverseSeries(revB, quotientSize));
+        revQ.resize(quotientSize);
+        result.quotient.assign(revQ.rbegin(), revQ.rend());
+
+        // r = a - b q; yalnızca alt m katsayı gereklidir
+        std::vector<T> bq = multiplyDense(b, result.quotient);
+        a.resize(m);
+        for(size_t i = 0; i < m && i < bq.size(); ++i)
+            a[i] -= bq[i];
+        result.remainder = std::move(a);
+    }
+    poly_detail::trim(result.quotient);
+    poly_detail::trim(result.remainder);
+    return result;
+}
+
+// a mod b, b monik (baş katsayısı 1). Katsayılar hiç bölünmediği için tamsayı tiplerinde de tamdır.
+template<typename T>
+std::vector<T> remainderMonic(const std::vector<T>& a, const std::vector<T>& b) {
+    if(b.empty() || b.back() != T(1))
+        throw std::invalid_argument("Divisor must be monic");
+    return divideDense(a, b).remainder;
+}
+
+// Sabit bir f'ye göre tekrarlı indirgeme: rev(f)^{-1} bir kez hesaplanır, her reduce iki çarpımdır.
+// deg a <= 2 deg f - 2 olan girdiler (iki kalanın çarpımı) için geçerlidir; daha büyükler divideDense'e düşer.
+template<typename T>
+class PolyModulus {
+private:
+    std::vector<T> modulus;
+    std::vector<T> inverseReversed;  // rev(f)^{-1} mod x^{deg f - 1}
+
+public:
+    explicit PolyModulus(std::vector<T> f) : modulus(std::move(f)) {
+        poly_detail::trim(modulus);
+        if(modulus.empty())
+            throw std::invalid_argument("Division by zero polynomial");
+        size_t m = modulus.size() - 1;
+        if(m > 1 && m >= KARATSUBA_THRESHOLD)
+            inverseReversed = inverseSeries(std::vector<T>(modulus.rbegin(), modulus.rend()), m - 1);
+        else
+            poly_detail::invertCoefficient(modulus.back());
+    }
+
+    const std::vector<T>& get() const { return modulus; }
+
+    std::vector<T> reduce(std::vector<T> a) const {
+        poly_detail::trim(a);
+        size_t m = modulus.size() - 1;
+        if(a.size() <= m)
+            return a;
+        size_t quotientSize = a.size() - m;
+        if(inverseReversed.empty() || quotientSize > inverseReversed.size() || quotientSize < NEWTON_DIVISION_THRESHOLD)
+            return divideDense(std::move(a), modulus).remainder;
+        std::vector<T> revA(a.rbegin(), a.rbegin() + quotientSize);
+        std::vector<T> head(inverseReversed.begin(), inverseReversed.begin() + quotientSize);
+        std::vector<T> revQ = multiplyDense(revA, head);
+        revQ.resize(quotientSize);
+        std::vector<T> q(revQ.rbegin(), revQ.rend());
+        std::vector<T> fq = multiplyDense(modulus, q);
+        a.resize(m);
+        for(size_t i = 0; i < m; ++i)
+            a[i] -= fq[i];
+        poly_detail::trim(a);
+        return a;
+    }
+};
+
+// base^e mod f - tekrarlı kare alma; her adım bir hızlı çarpım + bir PolyModulus indirgemesi, O(M(n) log e)
+template<typename T>
+std::vector<T> powModDense(const std::vector<T>& base, uint64_t e, const std::vector<T>& f) {
+    PolyModulus<T> mod(f);
+    std::vector<T> result = mod.reduce({T(1)});
+    std::vector<T> b = mod.reduce(base);
+    while(e) {
+        if(e & 1)
+            result = mod.reduce(multiplyDense(result, b));
+        e >>= 1;
+        if(e)
+            b = mod.reduce(multiplyDense(b, b));
+    }
+    return result;
+}
+
+// Kayan noktalı Öklid'de bu göreli büyüklüğün altındaki kalan katsayıları sıfır sayılır
+constexpr double POLY_GCD_EPSILON = 1e-9;
+
+// Öklid algoritmasıyla gcd(a, b); sonuç monik yapılır (sıfır polinomlar için boş).
+// Her adım divideDense kullanır; katsayılar bir cisim üzerinde olmalıdır (double, ModInt).
+template<typename T>
+std::vector<T> gcdDense(std::vector<T> a, std::vector<T> b) {
+    poly_detail::trim(a);
+    poly_detail::trim(b);
+    while(!b.empty()) {
+        std::vector<T> r = divideDense(a, b).remainder;
+        if constexpr(std::is_floating_point<T>::value) {
+            T scale = T();
+            for(const T& c : a)
+                scale = std::max(scale, std::abs(c));
+            for(T& c : r)
+                if(std::abs(c) <= POLY_GCD_EPSILON * scale)
+                    c = T();
+            poly_detail::trim(r);
+        }
+        a = std::move(b);
+        b = std::move(r);
+    }
+    if(!a.empty()) {
+        T leadInv = poly_detail::invertCoefficient(a.back());
+        for(T& c : a)
+            c *= leadInv;
+    }
+    return a;
+}
+
+#endif // POLY_DIVISION_H
@@ -0,0 +1,173 @@
+#ifndef POLY_EVALUATE_H
+#define POLY_EVALUATE_H
+
+#include "poly_multiply.h"
+#include "poly_division.h"
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+// Yoğun katsayı vektörü (c[k] = x^k katsayısı) için değerlendirme çekirdekleri.
+
+// Batch değerlendirmede aynı anda işlenen nokta sayısı (akümülatörler L1'de kalır)
+constexpr size_t EVALUATE_BLOCK = 256;
+// Estrin'in yığında tuttuğu en fazla katsayı sayısı; üstünde heap kullanılır
+constexpr size_t ESTRIN_STACK = 64;
+// Bu dereceden itibaren (ve kayan noktalı olmayan tiplerde) çok noktalı değerlendirme subproduct tree ile yapılır
+// (sparse_benchmark: Z/2^64'te Karatsuba ile ~32K derecede başabaş; NTT'li tiplerde daha erken kazanır)
+constexpr size_t MULTIPOINT_THRESHOLD = 32768;
+// Remainder tree'de inmenin bırakılıp Horner'a geçildiği düğüm boyutu
+constexpr size_t TREE_LEAF_POINTS = 64;
+
+// Horner: ((c_d x + c_{d-1}) x + ...) x + c_0 - d çarpma + d toplama, ama tamamen seri bağımlılık zinciri
+template<typename T>
+T hornerEvaluate(const T* c, size_t n, const T& x) {
+    T acc = T();
+    for(size_t k = n; k-- > 0;)
+        acc = acc * x + c[k];
+    return acc;
+}
+
+namespace poly_detail {
+
+// x^e - tekrarlı kare alma, O(log e)
+template<typename T>
+T power(T x, size_t e) {
+    T result = T(1);
+    while(e) {
+        if(e & 1)
+            result = result * x;
+        e >>= 1;
+        if(e)
+            x = x * x;  // Son bitten sonra kare alınmaz (gereksiz ve taşabilir)
+    }
+    return result;
+}
+
+} // namespace poly_detail
+
+// Estrin şeması: komşu katsayı çiftleri x, x^2, x^4, ... ile seviye seviye birleştirilir.
+// Bir seviyedeki birleştirmeler birbirinden bağımsız olduğu için (ILP) kritik yol O(log d) çarpmaya iner.
+template<typename T>
+T estrinEvaluate(const T* c, size_t n, const T& x) {
+    if(n == 0)
+        return T();
+    T local[ESTRIN_STACK];
+    std::vector<T> heap;
+    T* buf = local;
+    if(n > ESTRIN_STACK) {
+        heap.assign(c, c + n);
+        buf = heap.data();
+    } else {
+        std::copy(c, c + n, buf);
+    }
+    T p = x;
+    size_t len = n;
+    while(len > 1) {
+        size_t pairs = len / 2;
+        for(size_t i = 0; i < pairs; ++i)
+            buf[i] = buf[2 * i] + buf[2 * i + 1] * p;
+        if(len & 1)
+            buf[pairs] = buf[len - 1];
+        len = pairs + (len & 1);
+        p = p * p;
+    }
+    return buf[0];
+}
+
+// out[j] = p(xs[j]) - noktalar arasında vektörlenen Horner.
+// Her blokta önce tüm noktalar için aynı katsayı işlenir; iç döngü bağımsız noktalar üzerindedir.
+template<typename T>
+void evaluateBatch(const T* c, size_t n, const T* xs, size_t count, T* out) {
+    T acc[EVALUATE_BLOCK];
+    for(size_t begin = 0; begin < count; begin += EVALUATE_BLOCK) {
+        size_t len = std::min(EVALUATE_BLOCK, count - begin);
+        const T* x = xs + begin;
+        if(n == 0) {
+            std::fill(out + begin, out + begin + len, T());
+            continue;
+        }
+        for(size_t j = 0; j < len; ++j)
+            acc[j] = c[n - 1];
+        if(len == EVALUATE_BLOCK) {
+            // Tam blok: sabit uzunluklu iç döngü derleyicinin vektörlemesi için
+            for(size_t k = n - 1; k-- > 0;) {
+                T ck = c[k];
+                for(size_t j = 0; j < EVALUATE_BLOCK; ++j)
+                    acc[j] = acc[j] * x[j] + ck;
+            }
+        } else {
+            for(size_t k = n - 1; k-- > 0;) {
+                T ck = c[k];
+                for(size_t j = 0; j < len; ++j)
+                    acc[j] = acc[j] * x[j] + ck;
+            }
+        }
+        std::copy(acc, acc + len, out + begin);
+    }
+}
+
+// Subproduct tree: yapraklar (x - x_i), her iç düğüm iki çocuğunun çarpımı.
+// levels[0] yapraklar, levels.back() tek elemanlı kök.
+template<typename T>
+class SubproductTree {
+private:
+    std::vector<std::vector<std::vector<T>>> levels;
+    size_t pointCount;
+
+public:
+    SubproductTree(const T* xs, size_t count) : pointCount(count) {
+        std::vector<std::vector<T>> leaves(count);
+        for(size_t i = 0; i < count; ++i)
+            leaves[i] = {T() - xs[i], T(1)};
+        levels.push_back(std::move(leaves));
+        while(levels.back().size() > 1) {
+            const auto& below = levels.back();
+            std::vector<std::vector<T>> above((below.size() + 1) / 2);
+            for(size_t i = 0; i < above.size(); ++i)
+                above[i] = (2 * i + 1 < below.size()) ? multiplyDense(below[2 * i], below[2 * i + 1]) : below[2 * i];
+            levels.push_back(std::move(above));
+        }
+    }
+
+    // Kök: prod (x - x_i)
+    const std::vector<T>& root() const { return levels.back()[0]; }
+
+    // Remainder tree: p mod kök'ten başlayıp her düğümde çocuklara göre kalan alınır;
+    // yapraklarda kalan p(x_i) sabitidir. Düğüm en fazla TREE_LEAF_POINTS noktayı kapsadığında
+    // inmeyi bırakıp kalan (derecesi < düğüm boyutu) bu noktalarda batch Horner ile değerlendirilir.
+    void evaluate(const std::vector<T>& p, const T* xs, T* out) const {
+        if(pointCount == 0)
+            return;
+        std::vector<std::vector<T>> current = {remainderMonic(p, root())};
+        size_t level = levels.size() - 1;
+        for(; level > 0 && (size_t(1) << level) > TREE_LEAF_POINTS; --level) {
+            const auto& nodes = levels[level - 1];
+            std::vector<std::vector<T>> next(nodes.size());
+            for(size_t i = 0; i < nodes.size(); ++i)
+                next[i] = remainderMonic(current[i / 2], nodes[i]);
+            current = std::move(next);
+        }
+        size_t span = size_t(1) << level;  // Bu seviyede düğüm başına nokta
+        for(size_t i = 0; i < current.size(); ++i) {
+            size_t begin = i * span;
+            size_t len = std::min(span, pointCount - begin);
+            evaluateBatch(current[i].data(), current[i].size(), xs + begin, len, out + begin);
+        }
+    }
+};
+
+// Subproduct tree ile çok noktalı değerlendirme, O(M(d) log d) nokta bloğu başına.
+// Noktalar derece + 1 büyüklüğünde bloklara ayrılır; her blok için ağaç kurulup kalanlar inilir.
+// Kayan noktalı tiplerde ağaç katsayıları hızla büyüdüğü için sayısal olarak kararsızdır;
+// tamsayı ve modüler tipler için tasarlanmıştır.
+template<typename T>
+void evaluateMultipoint(const std::vector<T>& c, const T* xs, size_t count, T* out) {
+    size_t block = std::max<size_t>(c.size(), 64);
+    for(size_t begin = 0; begin < count; begin += block) {
+        size_t len = std::min(block, count - begin);
+        SubproductTree<T>(xs + begin, len).evaluate(c, xs + begin, out + begin);
+    }
+}
+
+#endif // POLY_EVALUATE_H
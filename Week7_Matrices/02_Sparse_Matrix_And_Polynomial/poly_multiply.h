@@ -0,0 +1,459 @@
+#ifndef POLY_MULTIPLY_H
+#define POLY_MULTIPLY_H
+
+#include <vector>
+#include <complex>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include "mod_int.h"
+
+// Yoğun katsayı vektörleri (a[k] = x^k katsayısı) için çarpma çekirdekleri.
+// multiplyDense boyuta göre schoolbook -> Karatsuba -> FFT/NTT arasında seçim yapar.
+
+// Kısa operand bu eşiğin altındaysa schoolbook O(nm) en hızlısıdır
+constexpr size_t KARATSUBA_THRESHOLD = 32;
+// Kısa operand bu eşiklerin üstündeyse O(n log n) dönüşümler Karatsuba'yı geçer
+// (sparse_benchmark "crossover" bölümüyle ölçüldü; NTT üç asal + CRT yaptığı için daha geç kazanır)
+constexpr size_t FFT_THRESHOLD = 256;
+constexpr size_t NTT_THRESHOLD = 8192;
+// ModInt katsayılarında NTT eşikleri: P NTT dostuysa tek dönüşüm erken kazanır,
+// değilse üç asal + CRT gerektiği için geç (sparse_benchmark "Z/p" bölümü)
+constexpr size_t MODULAR_NTT_THRESHOLD = 128;
+constexpr size_t MODULAR_CRT_THRESHOLD = 2048;
+
+namespace poly_detail {
+
+// Iteratif radix-2 Cooley-Tukey FFT; invert = true ise ters dönüşüm (1/n ölçeklemesi dahil)
+inline void fft(std::vector<std::complex<double>>& a, bool invert) {
+    size_t n = a.size();
+    for(size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for(; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if(i < j)
+            std::swap(a[i], a[j]);
+    }
+    const double pi = std::acos(-1.0);
+    for(size_t len = 2; len <= n; len <<= 1) {
+        double angle = 2 * pi / static_cast<double>(len) * (invert ? -1 : 1);
+        // Twiddle'lar her aşamada doğrudan hesaplanır (tekrarlı çarpmanın hata birikimi olmaz)
+        std::vector<std::complex<double>> w(len / 2);
+        for(size_t k = 0; k < len / 2; ++k)
+            w[k] = std::polar(1.0, angle * static_cast<double>(k));
+        for(size_t i = 0; i < n; i += len)
+            for(size_t k = 0; k < len / 2; ++k) {
+                std::complex<double> u = a[i + k];
+                std::complex<double> v = a[i + k + len / 2] * w[k];
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+            }
+    }
+    if(invert)
+        for(auto& x : a)
+            x /= static_cast<double>(n);
+}
+
+inline uint32_t powMod(uint64_t base, uint64_t exp, uint32_t mod) {
+    uint64_t result = 1;
+    base %= mod;
+    while(exp) {
+        if(exp & 1)
+            result = result * base % mod;
+        base = base * base % mod;
+        exp >>= 1;
+    }
+    return static_cast<uint32_t>(result);
+}
+
+// Number Theoretic Transform: Mod = c * 2^k + 1 asal, 3 ilkel kök.
+// Mod derleme zamanı sabiti olduğu için % işlemleri bölme yerine çarpma/kaydırmaya derlenir.
+template<uint32_t Mod>
+void ntt(std::vector<uint32_t>& a, bool invert) {
+    size_t n = a.size();
+    for(size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for(; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if(i < j)
+            std::swap(a[i], a[j]);
+    }
+    std::vector<uint32_t> w(n / 2 + 1);
+    for(size_t len = 2; len <= n; len <<= 1) {
+        uint32_t wlen = powMod(3, (Mod - 1) / len, Mod);
+        if(invert)
+            wlen = powMod(wlen, Mod - 2, Mod);
+        w[0] = 1;
+        for(size_t k = 1; k < len / 2; ++k)
+            w[k] = static_cast<uint32_t>(static_cast<uint64_t>(w[k - 1]) * wlen % Mod);
+        for(size_t i = 0; i < n; i += len)
+            for(size_t k = 0; k < len / 2; ++k) {
+                uint32_t u = a[i + k];
+                uint32_t v = static_cast<uint32_t>(static_cast<uint64_t>(a[i + k + len / 2]) * w[k] % Mod);
+                a[i + k] = u + v < Mod ? u + v : u + v - Mod;
+                a[i + k + len / 2] = u >= v ? u - v : u + Mod - v;
+            }
+    }
+    if(invert) {
+        uint64_t nInv = powMod(n, Mod - 2, Mod);
+        for(auto& x : a)
+            x = static_cast<uint32_t>(x * nInv % Mod);
+    }
+}
+
+// NTT dostu asallar (hepsinin ilkel kökü 3); en küçük 2-üssü 2^23 -> en fazla 8M uzunluk
+constexpr uint32_t NTT_PRIMES[3] = {998244353u, 167772161u, 469762049u};
+constexpr size_t NTT_MAX_LENGTH = size_t(1) << 23;
+
+// Kalan sınıflarına çevrilmiş iki dizinin Mod'a göre size uzunluklu döngüsel konvolüsyonu
+template<uint32_t Mod>
+std::vector<uint32_t> convolveModPrime(std::vector<uint32_t> fa, std::vector<uint32_t> fb, size_t size) {
+    fa.resize(size, 0);
+    fb.resize(size, 0);
+    ntt<Mod>(fa, false);
+    ntt<Mod>(fb, false);
+    for(size_t i = 0; i < size; ++i)
+        fa[i] = static_cast<uint32_t>(static_cast<uint64_t>(fa[i]) * fb[i] % Mod);
+    ntt<Mod>(fa, true);
+    return fa;
+}
+
+inline size_t nextPowerOfTwo(size_t n) {
+    size_t size = 1;
+    while(size < n)
+        size <<= 1;
+    return size;
+}
+
+// out[0 .. 2n-1) = a[0..n) * b[0..n) - eşit uzunluklu Karatsuba
+template<typename T>
+void karatsuba(const T* a, const T* b, size_t n, T* out) {
+    if(n <= KARATSUBA_THRESHOLD) {
+        std::fill(out, out + 2 * n - 1, T());
+        for(size_t i = 0; i < n; ++i)
+            for(size_t j = 0; j < n; ++j)
+                out[i + j] += a[i] * b[j];
+        return;
+    }
+    size_t m = n / 2;       // alt yarı
+    size_t h = n - m;       // üst yarı (h >= m)
+    // z0 = a0*b0 -> out[0, 2m-1), z2 = a1*b1 -> out[2m, 2n-1)
+    karatsuba(a, b, m, out);
+    out[2 * m - 1] = T();
+    karatsuba(a + m, b + m, h, out + 2 * m);
+
+    std::vector<T> sa(h), sb(h), z1(2 * h - 1);
+    for(size_t i = 0; i < h; ++i) {
+        sa[i] = a[m + i] + (i < m ? a[i] : T());
+        sb[i] = b[m + i] + (i < m ? b[i] : T());
+    }
+    karatsuba(sa.data(), sb.data(), h, z1.data());
+    for(size_t i = 0; i < 2 * m - 1; ++i)
+        z1[i] -= out[i];
+    for(size_t i = 0; i < 2 * h - 1; ++i)
+        z1[i] -= out[2 * m + i];
+    for(size_t i = 0; i < 2 * h - 1; ++i)
+        out[m + i] += z1[i];
+}
+
+} // namespace poly_detail
+
+// O(nm) schoolbook çarpım
+template<typename T>
+std::vector<T> multiplySchoolbook(const std::vector<T>& a, const std::vector<T>& b) {
+    if(a.empty() || b.empty())
+        return {};
+    std::vector<T> result(a.size() + b.size() - 1, T());
+    for(size_t i = 0; i < a.size(); ++i) {
+        if(a[i] == T())
+            continue;
+        for(size_t j = 0; j < b.size(); ++j)
+            result[i + j] += a[i] * b[j];
+    }
+    return result;
+}
+
+// Karatsuba O(n^1.585); dengesiz boyutlarda uzun operand kısa operand boyutunda parçalara bölünür
+template<typename T>
+std::vector<T> multiplyKaratsuba(const std::vector<T>& a, const std::vector<T>& b) {
+    if(a.empty() || b.empty())
+        return {};
+    const std::vector<T>& lng = a.size() >= b.size() ? a : b;
+    const std::vector<T>& sht = a.size() >= b.size() ? b : a;
+    size_t s = sht.size();
+    std::vector<T> result(a.size() + b.size() - 1, T());
+    std::vector<T> chunk(s), product(2 * s - 1);
+    for(size_t offset = 0; offset < lng.size(); offset += s) {
+        size_t len = std::min(s, lng.size() - offset);
+        std::copy(lng.begin() + offset, lng.begin() + offset + len, chunk.begin());
+        std::fill(chunk.begin() + len, chunk.end(), T());
+        poly_detail::karatsuba(chunk.data(), sht.data(), s, product.data());
+        size_t limit = std::min(product.size(), result.size() - offset);
+        for(size_t i = 0; i < limit; ++i)
+            result[offset + i] += product[i];
+    }
+    return result;
+}
+
+// Kayan noktalı katsayılar için karmaşık FFT ile O(n log n) çarpım
+template<typename T>
+std::vector<T> multiplyFFT(const std::vector<T>& a, const std::vector<T>& b) {
+    static_assert(std::is_floating_point<T>::value, "FFT multiply requires floating-point coefficients");
+    if(a.empty() || b.empty())
+        return {};
+    size_t resultSize = a.size() + b.size() - 1;
+    size_t size = poly_detail::nextPowerOfTwo(resultSize);
+    // İki gerçel diziyi tek karmaşık FFT'de taşı: (a + ib)^2 = a^2 - b^2 + 2iab -> Im / 2 = a*b
+    std::vector<std::complex<double>> fa(size);
+    for(size_t i = 0; i < a.size(); ++i)
+        fa[i].real(static_cast<double>(a[i]));
+    for(size_t i = 0; i < b.size(); ++i)
+        fa[i].imag(static_cast<double>(b[i]));
+    poly_detail::fft(fa, false);
+    for(auto& x : fa)
+        x *= x;
+    poly_detail::fft(fa, true);
+    std::vector<T> result(resultSize);
+    for(size_t i = 0; i < resultSize; ++i)
+        result[i] = static_cast<T>(fa[i].imag() / 2);
+    return result;
+}
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 PolyInt128;
+__extension__ typedef unsigned __int128 PolyUInt128;
+#endif
+
+// Tamsayı katsayılar için üç asallı NTT + CRT (Garner) ile tam (exact) çarpım.
+// p1*p2*p3 ~ 2^86 olduğundan CRT işaretli değerleri yalnızca |c| < ~2^85 aralığında tam bulur; bu yüzden
+// max|a| * max|b| * min(n, m) <= 2^84 ise sonuç schoolbook ile bit bit aynıdır (T'ye sığmayan değerler
+// schoolbook'taki gibi T'ye daraltılır: işaretsiz T için mod 2^bit). Sınır aşılabilecekse veya
+// 128-bit tamsayı yoksa Karatsuba'ya düşülür.
+template<typename T>
+std::vector<T> multiplyNTT(const std::vector<T>& a, const std::vector<T>& b) {
+    static_assert(std::is_integral<T>::value, "NTT multiply requires integral coefficients");
+    if(a.empty() || b.empty())
+        return {};
+    size_t resultSize = a.size() + b.size() - 1;
+    size_t size = poly_detail::nextPowerOfTwo(resultSize);
+#ifdef __SIZEOF_INT128__
+    auto magnitude = [](const std::vector<T>& v) {
+        PolyUInt128 m = 0;
+        for(const T& x : v) {
+            PolyUInt128 abs = (std::is_signed<T>::value && x < 0)
+                ? static_cast<PolyUInt128>(-static_cast<PolyInt128>(x)) : static_cast<PolyUInt128>(x);
+            m = std::max(m, abs);
+        }
+        return m;
+    };
+    // max|a| * max|b| * min(n, m) <= 2^84 kontrolü (taşmayı önlemek için bölme ile)
+    const PolyUInt128 bound = PolyUInt128(1) << 84;
+    PolyUInt128 ma = magnitude(a), mb = magnitude(b);
+    PolyUInt128 terms = std::min(a.size(), b.size());
+    bool safe = size <= poly_detail::NTT_MAX_LENGTH &&
+                (ma == 0 || mb == 0 || (mb <= bound / ma && ma * mb <= bound / terms));
+    if(!safe)
+        return multiplyKaratsuba(a, b);
+
+    auto reduce = [](const std::vector<T>& v, uint32_t p) {
+        std::vector<uint32_t> r(v.size());
+        for(size_t i = 0; i < v.size(); ++i) {
+            PolyInt128 x = static_cast<PolyInt128>(v[i]) % p;
+            r[i] = static_cast<uint32_t>(x < 0 ? x + p : x);
+        }
+        return r;
+    };
+    constexpr uint32_t P1 = poly_detail::NTT_PRIMES[0], P2 = poly_detail::NTT_PRIMES[1], P3 = poly_detail::NTT_PRIMES[2];
+    std::vector<uint32_t> residues[3] = {
+        poly_detail::convolveModPrime<P1>(reduce(a, P1), reduce(b, P1), size),
+        poly_detail::convolveModPrime<P2>(reduce(a, P2), reduce(b, P2), size),
+        poly_detail::convolveModPrime<P3>(reduce(a, P3), reduce(b, P3), size)};
+
+    const uint64_t p1 = poly_detail::NTT_PRIMES[0], p2 = poly_detail::NTT_PRIMES[1], p3 = poly_detail::NTT_PRIMES[2];
+    const uint64_t p1InvP2 = poly_detail::powMod(p1, p2 - 2, static_cast<uint32_t>(p2));
+    const uint64_t p12InvP3 = poly_detail::powMod((p1 % p3) * (p2 % p3) % p3, p3 - 2, static_cast<uint32_t>(p3));
+    const PolyUInt128 p12 = static_cast<PolyUInt128>(p1) * p2;
+    const PolyUInt128 modulus = p12 * p3;
+    std::vector<T> result(resultSize);
+    for(size_t i = 0; i < resultSize; ++i) {
+        uint64_t r1 = residues[0][i], r2 = residues[1][i], r3 = residues[2][i];
+        uint64_t x2 = (r2 + p2 - r1 % p2) % p2 * p1InvP2 % p2;
+        uint64_t x12ModP3 = (r1 + (p1 % p3) * x2) % p3;
+        uint64_t x3 = (r3 + p3 - x12ModP3) % p3 * p12InvP3 % p3;
+        PolyUInt128 value = r1 + static_cast<PolyUInt128>(p1) * x2 + p12 * x3;
+        if(!std::is_signed<T>::value) {
+            result[i] = static_cast<T>(value);  // c >= 0: daraltma mod 2^bit, schoolbook'taki taşma ile aynı
+            continue;
+        }
+        PolyInt128 signedValue = value > modulus / 2 ? static_cast<PolyInt128>(value) - static_cast<PolyInt128>(modulus)
+                                                     : static_cast<PolyInt128>(value);
+        result[i] = static_cast<T>(signedValue);
+    }
+    return result;
+#else
+    (void)size;
+    return multiplyKaratsuba(a, b);
+#endif
+}
+
+// Z/P katsayıları için NTT çarpımı. P NTT dostu asallardan biriyse tek dönüşüm yeterlidir;
+// değilse gerçek katsayılar (< n P^2 < p1 p2 p3) üç asalla bulunur ve Garner adımları doğrudan mod P yapılır.
+template<uint32_t P>
+std::vector<ModInt<P>> multiplyModular(const std::vector<ModInt<P>>& a, const std::vector<ModInt<P>>& b) {
+    if(a.empty() || b.empty())
+        return {};
+    size_t resultSize = a.size() + b.size() - 1;
+    size_t size = poly_detail::nextPowerOfTwo(resultSize);
+    if(size > poly_detail::NTT_MAX_LENGTH)
+        return multiplyKaratsuba(a, b);
+    auto raw = [](const std::vector<ModInt<P>>& v) {
+        std::vector<uint32_t> r(v.size());
+        for(size_t i = 0; i < v.size(); ++i)
+            r[i] = v[i].value();
+        return r;
+    };
+    std::vector<uint32_t> fa = raw(a), fb = raw(b);
+    std::vector<ModInt<P>> result(resultSize);
+    constexpr uint32_t P1 = poly_detail::NTT_PRIMES[0], P2 = poly_detail::NTT_PRIMES[1], P3 = poly_detail::NTT_PRIMES[2];
+    if constexpr(P == P1 || P == P2 || P == P3) {
+        std::vector<uint32_t> c = poly_detail::convolveModPrime<P>(std::move(fa), std::move(fb), size);
+        for(size_t i = 0; i < resultSize; ++i)
+            result[i] = ModInt<P>(c[i]);
+        return result;
+    } else {
+        // Temsilciler < P < 2^31 ama NTT asallarından büyük olabilir; önce her asala indirgenir
+        auto reduce = [](std::vector<uint32_t> v, uint32_t p) {
+            for(auto& x : v)
+                x %= p;
+            return v;
+        };
+        std::vector<uint32_t> r1 = poly_detail::convolveModPrime<P1>(reduce(fa, P1), reduce(fb, P1), size);
+        std::vector<uint32_t> r2 = poly_detail::convolveModPrime<P2>(reduce(fa, P2), reduce(fb, P2), size);
+        std::vector<uint32_t> r3 = poly_detail::convolveModPrime<P3>(reduce(fa, P3), reduce(fb, P3), size);
+        const uint64_t p1 = P1, p2 = P2, p3 = P3;
+        const uint64_t p1InvP2 = poly_detail::powMod(p1, p2 - 2, P2);
+        const uint64_t p12InvP3 = poly_detail::powMod((p1 % p3) * (p2 % p3) % p3, p3 - 2, P3);
+        const uint64_t p1ModP = p1 % P, p12ModP = p1ModP * (p2 % P) % P;
+        for(size_t i = 0; i < resultSize; ++i) {
+            uint64_t x2 = (r2[i] + p2 - r1[i] % p2) % p2 * p1InvP2 % p2;
+            uint64_t x12ModP3 = (r1[i] + (p1 % p3) * x2) % p3;
+            uint64_t x3 = (r3[i] + p3 - x12ModP3) % p3 * p12InvP3 % p3;
+            // value = r1 + p1 x2 + p1 p2 x3, her terim ayrı ayrı mod P
+            uint64_t value = (r1[i] % P + p1ModP * x2 % P + p12ModP * x3 % P) % P;
+            result[i] = ModInt<P>(static_cast<long long>(value));
+        }
+        return result;
+    }
+}
+
+namespace poly_detail {
+
+// Min-heap girdisi: akışın sıradaki çarpım üssü ve akış numarası
+struct StreamHead {
+    size_t power;
+    size_t stream;
+};
+
+// heap[pos]'u aşağı iter; tepe değiştirilince tek sift-down pop + push'un yerini tutar
+inline void siftDown(std::vector<StreamHead>& heap, size_t pos) {
+    size_t n = heap.size();
+    StreamHead moving = heap[pos];
+    while(true) {
+        size_t child = 2 * pos + 1;
+        if(child >= n)
+            break;
+        if(child + 1 < n && heap[child + 1].power < heap[child].power)
+            ++child;
+        if(heap[child].power >= moving.power)
+            break;
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    heap[pos] = moving;
+}
+
+inline void siftUp(std::vector<StreamHead>& heap, size_t pos) {
+    StreamHead moving = heap[pos];
+    while(pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        if(heap[parent].power <= moving.power)
+            break;
+        heap[pos] = heap[parent];
+        pos = parent;
+    }
+    heap[pos] = moving;
+}
+
+} // namespace poly_detail
+
+// Seyrek çarpım: (üs, katsayı) dizileri üs'e göre artan sıralı olmalı; sonuç da sıralı ve sıfırsızdır.
+// Johnson / Monagan-Pearce heap merge: kısa dizinin her terimi a_i, uzun dizi boyunca bir akış
+// a_i b_0, a_i b_1, ... üretir. Akışların başları min-heap'tedir; aynı üslü çarpımlar ardışık çıkıp
+// toplanır, sonuç yalnızca sona eklenerek yazılır. Akış i+1 heap'e ancak akış i ilk terimini verince
+// girer, böylece heap küçük kalır. O(nm log min(n, m)) zaman, O(min(n, m)) ek bellek.
+template<typename T>
+std::vector<std::pair<size_t, T>> multiplySparseTerms(const std::vector<std::pair<size_t, T>>& a,
+                                                      const std::vector<std::pair<size_t, T>>& b) {
+    std::vector<std::pair<size_t, T>> result;
+    if(a.empty() || b.empty())
+        return result;
+    const auto& sht = a.size() <= b.size() ? a : b;
+    const auto& lng = a.size() <= b.size() ? b : a;
+    std::vector<size_t> next(sht.size(), 0);  // Her akışın sıradaki uzun dizi indisi
+    std::vector<poly_detail::StreamHead> heap;
+    heap.reserve(sht.size());
+    heap.push_back({sht[0].first + lng[0].first, 0});
+    while(!heap.empty()) {
+        size_t power = heap[0].power;
+        T sum = T();
+        do {
+            size_t i = heap[0].stream;
+            size_t j = next[i]++;
+            sum += sht[i].second * lng[j].second;
+            // Akış devam ediyorsa tepeyi yerinde değiştir, bitiyorsa son elemanı tepeye al
+            if(j + 1 < lng.size()) {
+                heap[0].power = sht[i].first + lng[j + 1].first;
+            } else {
+                heap[0] = heap.back();
+                heap.pop_back();
+            }
+            if(!heap.empty())
+                poly_detail::siftDown(heap, 0);
+            if(j == 0 && i + 1 < sht.size()) {
+                heap.push_back({sht[i + 1].first + lng[0].first, i + 1});
+                poly_detail::siftUp(heap, heap.size() - 1);
+            }
+        } while(!heap.empty() && heap[0].power == power);
+        if(sum != T())
+            result.emplace_back(power, sum);
+    }
+    return result;
+}
+
+// Boyuta ve katsayı tipine göre en uygun çarpım
+template<typename T>
+std::vector<T> multiplyDense(const std::vector<T>& a, const std::vector<T>& b) {
+    size_t shortSize = std::min(a.size(), b.size());
+    if(shortSize < KARATSUBA_THRESHOLD)
+        return multiplySchoolbook(a, b);
+    if constexpr(std::is_floating_point<T>::value) {
+        if(shortSize >= FFT_THRESHOLD)
+            return multiplyFFT(a, b);
+    } else if constexpr(std::is_integral<T>::value) {
+        if(shortSize >= NTT_THRESHOLD)
+            return multiplyNTT(a, b);
+    } else if constexpr(IsModInt<T>::value) {
+        constexpr uint32_t P = T::modulus();
+        constexpr bool nttFriendly = P == poly_detail::NTT_PRIMES[0] || P == poly_detail::NTT_PRIMES[1] ||
+                                     P == poly_detail::NTT_PRIMES[2];
+        if(shortSize >= (nttFriendly ? MODULAR_NTT_THRESHOLD : MODULAR_CRT_THRESHOLD))
+            return multiplyModular(a, b);
+    }
+    return multiplyKaratsuba(a, b);
+}
+
+#endif // POLY_MULTIPLY_H
@@ -0,0 +1,419 @@
+#include "sparse_matrix.h"
+#include "compressed_sparse.h"
+#include "sparse_builder.h"
+#include "blocked_sparse.h"
+#include "sparse_io.h"
+#include "sparse_solvers.h"
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <string>
+
+// Fonksiyonu verilen sayıda çalıştırıp ortalama süreyi (ms) döndürür
+template<typename F>
+double measure(F&& f, int repeat) {
+    auto start = std::chrono::steady_clock::now();
+    for(int r = 0; r < repeat; ++r)
+        f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / repeat;
+}
+
+// Her satırda perRow adet rastgele sütun içeren COO matrix
+SparseMatrix<double> randomMatrix(size_t rows, size_t cols, size_t perRow, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<size_t> col(0, cols - 1);
+    SparseMatrix<double> coo(rows, cols);
+    for(size_t i = 0; i < rows; ++i)
+        for(size_t k = 0; k < perRow; ++k)
+            coo.addElement(i, col(rng), 1.0 + static_cast<double>(k));
+    return coo;
+}
+
+// Power-law (Chung-Lu benzeri) graf: i. düğümün derecesi ~ maxDegree / (i + 1)^alpha,
+// komşular da aynı dağılımdan seçilir -> birkaç hub, çok sayıda düşük dereceli düğüm
+SparseMatrix<double> powerLawGraph(size_t nodes, size_t avgDegree, double alpha, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<double> weights(nodes);
+    for(size_t i = 0; i < nodes; ++i)
+        weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), alpha);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+    SparseMatrix<double> coo(nodes, nodes);
+    for(size_t e = 0; e < nodes * avgDegree; ++e)
+        coo.addElement(pick(rng), pick(rng), 1.0);
+    return coo;
+}
+
+// SpMV'nin okuduğu/yazdığı minimum byte: değerler + indeksler + pointer'lar + x + y
+double spmvBytes(size_t rows, size_t cols, size_t nnz) {
+    return static_cast<double>(nnz * (sizeof(double) + sizeof(size_t)) +
+                               (rows + 1) * sizeof(size_t) + (rows + cols) * sizeof(double));
+}
+
+int main() {
+    const size_t rows = 1000000, cols = 1000000, perRow = 10;
+    const int repeat = 5;
+    std::vector<double> sinkY;
+
+    std::cout << "-- COO -> CSR/CSC dönüşümü --\n";
+    SparseMatrix<double> coo = randomMatrix(rows, cols, perRow, 42);
+    CSRMatrix<double> csr(0, 0);
+    double convert = measure([&] { csr = CSRMatrix<double>::fromCOO(coo); }, 1);
+    std::cout << "COO -> CSR (" << coo.getNonZeroCount() << " nnz): " << convert << " ms\n";
+    CSCMatrix<double> csc = csr.toCSC();
+    coo = SparseMatrix<double>(0, 0);  // COO belleğini serbest bırak
+
+    size_t nnz = csr.getNonZeroCount();
+    std::vector<double> x(cols, 1.0);
+    double bytes = spmvBytes(rows, cols, nnz);
+
+    std::cout << "\n-- SpMV (" << nnz << " nnz) --\n";
+    auto reportBandwidth = [&](const char* name, double ms) {
+        std::cout << name << ": " << ms << " ms, " << (bytes / (ms * 1e-3)) / 1e9 << " GB/s\n";
+    };
+    reportBandwidth("CSR serial", measure([&] { sinkY = csr.multiply(x); }, repeat));
+    for(size_t threads : {2, 4, 8})
+        reportBandwidth(("CSR parallel x" + std::to_string(threads)).c_str(),
+                        measure([&] { sinkY = csr.multiplyParallel(x, threads); }, repeat));
+    reportBandwidth("CSC (axpy)", measure([&] { sinkY = csc.multiply(x); }, repeat));
+    reportBandwidth("CSR transposed", measure([&] { sinkY = csr.multiplyTransposed(x); }, repeat));
+    std::cout << "CSR transpose: " << measure([&] { csr.transpose(); }, 1) << " ms\n";
+
+    csc = CSCMatrix<double>(0, 0);
+    csr = CSRMatrix<double>(0, 0);
+
+    std::cout << "\n-- SpGEMM A*A (power-law graf) --\n";
+    CSRMatrix<double> graph = CSRMatrix<double>::fromCOO(powerLawGraph(50000, 4, 0.6, 7));
+    std::cout << "nodes = " << graph.getRows() << ", nnz = " << graph.getNonZeroCount() << "\n";
+    size_t productNnz = 0;
+    for(SpGEMMAccumulator mode : {SpGEMMAccumulator::Dense, SpGEMMAccumulator::Hash}) {
+        const char* name = (mode == SpGEMMAccumulator::Dense) ? "dense acc" : "hash acc";
+        double serial = measure([&] { productNnz = graph.multiply(graph, mode).getNonZeroCount(); }, 1);
+        std::cout << name << " serial: " << serial << " ms (nnz(C) = " << productNnz << ")\n";
+        for(size_t threads : {2, 4, 8}) {
+            double parallel = measure([&] { graph.multiplyParallel(graph, threads, mode); }, 1);
+            std::cout << name << " x" << threads << ": " << parallel << " ms, speedup x"
+                      << serial / parallel << "\n";
+        }
+    }
+    std::cout << "Sparse add A+A^T: "
+              << measure([&] { productNnz = graph.add(graph.transpose()).getNonZeroCount(); }, repeat)
+              << " ms\n";
+
+    std::cout << "\n-- Builder (10M sırasız üçlü, ~%10 tekrar) --\n";
+    {
+        const size_t triplets = 10000000, dim = 3000000;
+        std::mt19937_64 rng(11);
+        std::vector<size_t> ri(triplets), ci(triplets);
+        std::vector<double> vi(triplets, 1.0);
+        for(size_t p = 0; p < triplets; ++p) {
+            ri[p] = rng() % dim;
+            ci[p] = (p % 10 == 0 && p > 0) ? ci[p - 1] : rng() % dim;
+            if(p % 10 == 0 && p > 0) ri[p] = ri[p - 1];
+        }
+        for(size_t threads : {1, 2, 4}) {
+            SparseMatrixBuilder<double> builder(dim, dim);
+            builder.addTriplets(ri.data(), ci.data(), vi.data(), triplets);
+            size_t nnz = 0;
+            double ms = measure([&] { nnz = builder.build(std::plus<double>(), threads).getNonZeroCount(); }, 1);
+            std::cout << "radix build x" << threads << ": " << ms << " ms (nnz = " << nnz << ")\n";
+        }
+        // Baseline: karşılaştırmalı stable sort
+        std::vector<std::pair<uint64_t, double>> pairs(triplets);
+        for(size_t p = 0; p < triplets; ++p)
+            pairs[p] = {static_cast<uint64_t>(ri[p]) * dim + ci[p], vi[p]};
+        double ms = measure([&] {
+            std::stable_sort(pairs.begin(), pairs.end(),
+                             [](const auto& a, const auto& b) { return a.first < b.first; });
+        }, 1);
+        std::cout << "std::stable_sort baseline (sadece sıralama): " << ms << " ms\n";
+    }
+
+    std::cout << "\n-- BSR / SELL-C-σ SpMV ve auto-tuner --\n";
+    {
+        // 3x3 blok yapılı (FEM benzeri) matrix: her blok satırında 9 yoğun 3x3 blok
+        const size_t blockRowsCount = 100000;
+        SparseMatrixBuilder<double> fem(blockRowsCount * 3, blockRowsCount * 3);
+        std::mt19937_64 rng(21);
+        for(size_t b = 0; b < blockRowsCount; ++b)
+            for(size_t k = 0; k < 9; ++k) {
+                size_t bj = (k == 0) ? b : rng() % blockRowsCount;
+                for(size_t r = 0; r < 3; ++r)
+                    for(size_t c = 0; c < 3; ++c)
+                        fem.add(b * 3 + r, bj * 3 + c, 1.0 + r + c);
+            }
+        std::vector<std::pair<const char*, CSRMatrix<double>>> cases;
+        cases.emplace_back("FEM 3x3 bloklar", fem.build());
+        cases.emplace_back("power-law graf", graph);
+        cases.emplace_back("uniform 4/satır", CSRMatrix<double>::fromCOO(randomMatrix(300000, 300000, 4, 5)));
+
+        for(const auto& entry : cases) {
+            const CSRMatrix<double>& a = entry.second;
+            std::vector<double> xa(a.getCols(), 1.0);
+            std::cout << entry.first << " (" << a.getRows() << " satır, " << a.getNonZeroCount() << " nnz)\n";
+            std::cout << "  CSR: " << measure([&] { sinkY = a.multiply(xa); }, repeat) << " ms\n";
+            for(size_t bs : {2, 3, 4}) {
+                BSRMatrix<double> bsr = BSRMatrix<double>::fromCSR(a, bs, bs);
+                std::cout << "  BSR " << bs << "x" << bs << " (fill " << bsr.fillRatio() << "): "
+                          << measure([&] { sinkY = bsr.multiply(xa); }, repeat) << " ms\n";
+            }
+            for(size_t sigma : {8, 256, 2048}) {
+                SELLMatrix<double> sell = SELLMatrix<double>::fromCSR(a, 8, sigma);
+                std::cout << "  SELL-8-" << sigma << " (fill " << sell.fillRatio() << "): "
+                          << measure([&] { sinkY = sell.multiply(xa); }, repeat) << " ms\n";
+            }
+            TunedSparseMatrix<double> tuned = TunedSparseMatrix<double>::fromCSR(a);
+            std::cout << "  tuner: " << tuned.getChoice().describe() << ", "
+                      << measure([&] { sinkY = tuned.multiply(xa); }, repeat) << " ms\n";
+        }
+    }
+
+    std::cout << "\n-- Matrix Market / binary CSR I/O (5M nnz) --\n";
+    {
+        const std::string mtxPath = "/tmp/sparse_benchmark.mtx";
+        const std::string binPath = "/tmp/sparse_benchmark.csrb";
+        CSRMatrix<double> a = CSRMatrix<double>::fromCOO(randomMatrix(500000, 500000, 10, 77));
+        std::cout << "writeMatrixMarket: " << measure([&] { writeMatrixMarket(a, mtxPath); }, 1) << " ms\n";
+
+        // Baseline: ifstream >> ile satır satır okuma + COO -> CSR
+        double streamMs = measure([&] {
+            std::ifstream in(mtxPath);
+            std::string line;
+            std::getline(in, line);
+            size_t r = 0, c = 0, count = 0;
+            in >> r >> c >> count;
+            SparseMatrix<double> coo(r, c);
+            for(size_t p = 0; p < count; ++p) {
+                size_t i = 0, j = 0;
+                double v = 0;
+                in >> i >> j >> v;
+                coo.addElement(i - 1, j - 1, v);
+            }
+            sinkY.assign(1, static_cast<double>(CSRMatrix<double>::fromCOO(coo).getNonZeroCount()));
+        }, 1);
+        std::cout << "iostream baseline: " << streamMs << " ms\n";
+        for(size_t threads : {1, 2, 4}) {
+            size_t loaded = 0;
+            double ms = measure([&] { loaded = readMatrixMarket<double>(mtxPath, threads).getNonZeroCount(); }, 1);
+            std::cout << "readMatrixMarket x" << threads << ": " << ms << " ms (nnz = " << loaded
+                      << ", speedup x" << streamMs / ms << ")\n";
+        }
+
+        std::cout << "writeBinaryCSR: " << measure([&] { writeBinaryCSR(a, binPath); }, 1) << " ms\n";
+        size_t viewNnz = 0;
+        double openMs = measure([&] { viewNnz = CSRMatrixView<double>(binPath).getNonZeroCount(); }, repeat);
+        std::cout << "CSRMatrixView open: " << openMs << " ms (nnz = " << viewNnz << ")\n";
+        CSRMatrixView<double> view(binPath);
+        std::vector<double> xa(a.getCols(), 1.0);
+        std::cout << "CSRMatrixView SpMV: " << measure([&] { sinkY = view.multiply(xa); }, repeat)
+                  << " ms, CSR SpMV: " << measure([&] { sinkY = a.multiply(xa); }, repeat) << " ms\n";
+        std::remove(mtxPath.c_str());
+        std::remove(binPath.c_str());
+    }
+
+    std::cout << "\n-- Iteratif çözücüler (512x512 ızgara, 262144 bilinmeyen) --\n";
+    {
+        const size_t grid = 512, n = grid * grid;
+        auto gridOperator = [&](double convection) {
+            SparseMatrixBuilder<double> builder(n, n);
+            for(size_t r = 0; r < grid; ++r)
+                for(size_t c = 0; c < grid; ++c) {
+                    size_t i = r * grid + c;
+                    builder.add(i, i, 4.0);
+                    if(c > 0) builder.add(i, i - 1, -1.0 - convection);
+                    if(c + 1 < grid) builder.add(i, i + 1, -1.0 + convection);
+                    if(r > 0) builder.add(i, i - grid, -1.0);
+                    if(r + 1 < grid) builder.add(i, i + grid, -1.0);
+                }
+            return builder.build();
+        };
+        CSRMatrix<double> poisson = gridOperator(0.0);
+        CSRMatrix<double> convective = gridOperator(0.3);
+        std::vector<double> b(n, 1.0);
+        double matrixBytes = spmvBytes(n, n, poisson.getNonZeroCount());
+        double vectorBytes = static_cast<double>(n * sizeof(double));
+
+        // vectorPasses: iterasyon başına SpMV dışındaki tahmini vektör okuma/yazma sayısı
+        auto run = [&](const char* name, size_t spmvPerIteration, double vectorPasses, auto&& solve) {
+            SolverResult result;
+            double ms = measure([&] { result = solve(); }, 1);
+            double perIteration = result.iterations ? ms / result.iterations : 0;
+            double bytes = spmvPerIteration * matrixBytes + vectorPasses * vectorBytes;
+            std::cout << name << ": " << result.iterations << " iter, residual " << result.residual
+                      << ", " << perIteration << " ms/iter, ~"
+                      << (perIteration > 0 ? bytes / (perIteration * 1e-3) / 1e9 : 0) << " GB/s\n";
+        };
+
+        for(size_t threads : {1, 4}) {
+            SolverOptions options;
+            options.tolerance = 1e-6;
+            options.maxIterations = 1000;
+            options.threads = threads;
+            std::cout << "threads = " << threads << "\n";
+            JacobiPreconditioner<double> jacobi(poisson);
+            ILU0Preconditioner<double> ilu(poisson);
+            ILU0Preconditioner<double> iluConvective(convective);
+            std::vector<double> x;
+            run("  CG + Jacobi", 1, 16, [&] { x.clear(); return conjugateGradient(poisson, b, x, jacobi, options); });
+            run("  CG + ILU(0)", 1, 13 + 2 * spmvBytes(n, n, poisson.getNonZeroCount()) / vectorBytes,
+                [&] { x.clear(); return conjugateGradient(poisson, b, x, ilu, options); });
+            run("  BiCGSTAB + ILU(0)", 2, 20 + 4 * spmvBytes(n, n, convective.getNonZeroCount()) / vectorBytes,
+                [&] { x.clear(); return biCGSTAB(convective, b, x, iluConvective, options); });
+            run("  GMRES(30) + Jacobi", 1, 35,
+                [&] { x.clear(); return gmres(convective, b, x, JacobiPreconditioner<double>(convective), options); });
+        }
+    }
+
+    std::cout << "\n-- Polynomial çarpım crossover (n x n katsayı) --\n";
+    {
+        std::mt19937_64 rng(3);
+        std::vector<long long> sinkPoly;
+        std::vector<double> sinkReal;
+        for(size_t n : {16, 32, 64, 128, 256, 512, 1024, 4096, 16384}) {
+            std::vector<long long> a(n), b(n);
+            std::vector<double> fa(n), fb(n);
+            for(size_t k = 0; k < n; ++k) {
+                a[k] = static_cast<long long>(rng() % 2001) - 1000;
+                b[k] = static_cast<long long>(rng() % 2001) - 1000;
+                fa[k] = static_cast<double>(a[k]);
+                fb[k] = static_cast<double>(b[k]);
+            }
+            int reps = n <= 1024 ? 20 : 2;
+            double school = measure([&] { sinkPoly = multiplySchoolbook(a, b); }, reps);
+            double kara = measure([&] { sinkPoly = multiplyKaratsuba(a, b); }, reps);
+            double nttMs = measure([&] { sinkPoly = multiplyNTT(a, b); }, reps);
+            double fftMs = measure([&] { sinkReal = multiplyFFT(fa, fb); }, reps);
+            double schoolReal = measure([&] { sinkReal = multiplySchoolbook(fa, fb); }, reps);
+            double karaReal = measure([&] { sinkReal = multiplyKaratsuba(fa, fb); }, reps);
+            std::cout << "n = " << n << ": int64 schoolbook " << school << " ms, Karatsuba " << kara
+                      << " ms, NTT " << nttMs << " ms | double schoolbook " << schoolReal
+                      << " ms, Karatsuba " << karaReal << " ms, FFT " << fftMs << " ms\n";
+        }
+    }
+
+    std::cout << "\n-- Polynomial sparse/dense crossover (derece D, t terim) --\n";
+    {
+        std::mt19937_64 rng(4);
+        size_t sink = 0;
+        for(size_t D : {2000, 20000, 200000})
+            for(size_t t : {10, 30, 100, 300, 1000, 3000}) {
+                if(t > D / 2)
+                    continue;
+                Polynomial<long long> a, b;
+                for(size_t k = 0; k < t; ++k) {
+                    a.addTerm(rng() % D, static_cast<long long>(rng() % 100) + 1);
+                    b.addTerm(rng() % D, static_cast<long long>(rng() % 100) + 1);
+                }
+                a.addTerm(D, 1);
+                b.addTerm(D, 1);
+                a.convertTo(PolynomialStorage::Sparse);
+                b.convertTo(PolynomialStorage::Sparse);
+                std::vector<std::pair<size_t, long long>> ta = a.getTerms(), tb = b.getTerms();
+                // Önceki yöntem: map'e rastgele sıralı ekleme
+                double mapMs = measure([&] {
+                    std::map<size_t, long long> acc;
+                    for(const auto& x : ta)
+                        for(const auto& y : tb)
+                            acc[x.first + y.first] += x.second * y.second;
+                    sink += acc.size();
+                }, 3);
+                double heapMs = measure([&] { sink += multiplySparseTerms(ta, tb).size(); }, 3);
+                double denseMs = measure([&] { sink += multiplyDense(a.toDense(), b.toDense()).size(); }, 3);
+                double autoMs = measure([&] { sink += (a * b).getTermCount(); }, 3);
+                std::cout << "D = " << D << ", t = " << ta.size() << ": map " << mapMs << " ms, heap " << heapMs
+                          << " ms, dense " << denseMs << " ms, operator* " << autoMs << " ms\n";
+            }
+        std::cout << "(" << sink % 10 << ")\n";
+    }
+
+    std::cout << "\n-- Polynomial değerlendirme --\n";
+    {
+        std::mt19937_64 rng(8);
+        const size_t points = 4000000;
+        std::vector<double> coeffs(21), xs(points), ys(points);
+        for(auto& c : coeffs) c = static_cast<double>(rng() % 200) / 100.0 - 1.0;
+        for(auto& x : xs) x = static_cast<double>(rng() % 2000) / 1000.0 - 1.0;
+        Polynomial<double> curve = Polynomial<double>::fromCoefficients(coeffs);
+        double horner = measure([&] {
+            for(size_t j = 0; j < points; ++j)
+                ys[j] = curve.evaluate(xs[j]);
+        }, 3);
+        double estrin = measure([&] {
+            for(size_t j = 0; j < points; ++j)
+                ys[j] = curve.evaluateEstrin(xs[j]);
+        }, 3);
+        double batch = measure([&] { curve.evaluate(xs.data(), points, ys.data()); }, 3);
+        std::cout << "derece 20, " << points << " nokta: Horner " << horner << " ms, Estrin " << estrin
+                  << " ms, batch " << batch << " ms (" << points / (batch * 1e-3) / 1e6 << " M nokta/s)\n";
+
+        // Subproduct tree vs batch Horner (Z/2^64), derece d, 4(d+1) nokta
+        for(size_t d : {511, 2047, 8191, 32767}) {
+            std::vector<unsigned long long> c(d + 1), px(4 * (d + 1)), out(px.size());
+            for(auto& v : c) v = rng();
+            for(auto& v : px) v = rng();
+            double tree = measure([&] { evaluateMultipoint(c, px.data(), px.size(), out.data()); }, 1);
+            double hornerBatch = measure([&] { evaluateBatch(c.data(), c.size(), px.data(), px.size(), out.data()); }, 1);
+            std::cout << "derece " << d << ", " << px.size() << " nokta: subproduct tree " << tree
+                      << " ms, batch Horner " << hornerBatch << " ms\n";
+        }
+    }
+
+    std::cout << "\n-- Polynomial Z/p çarpım ve bölme --\n";
+    {
+        using NttMod = ModInt<998244353>;
+        using BigMod = ModInt<1000000007>;
+        std::mt19937_64 rng(12);
+        auto randomMod = [&](auto zero, size_t n) {
+            using M = decltype(zero);
+            std::vector<M> v(n);
+            for(auto& c : v) c = M(static_cast<long long>(rng() % M::modulus()));
+            v.back() = M(1);
+            return v;
+        };
+        std::vector<NttMod> sinkNtt;
+        std::vector<BigMod> sinkBig;
+        for(size_t n : {32, 64, 128, 256, 1024, 4096}) {
+            std::vector<NttMod> a = randomMod(NttMod(), n), b = randomMod(NttMod(), n);
+            std::vector<BigMod> c = randomMod(BigMod(), n), d = randomMod(BigMod(), n);
+            int reps = n <= 256 ? 50 : 5;
+            double karaNtt = measure([&] { sinkNtt = multiplyKaratsuba(a, b); }, reps);
+            double nttMs = measure([&] { sinkNtt = multiplyModular(a, b); }, reps);
+            double karaBig = measure([&] { sinkBig = multiplyKaratsuba(c, d); }, reps);
+            double crtMs = measure([&] { sinkBig = multiplyModular(c, d); }, reps);
+            std::cout << "n = " << n << ": mod 998244353 Karatsuba " << karaNtt << " ms, NTT " << nttMs
+                      << " ms | mod 1e9+7 Karatsuba " << karaBig << " ms, 3-asal NTT " << crtMs << " ms\n";
+        }
+        // 2n / n bölme: O(n^2) long division vs Newton (seri tersi + iki hızlı çarpım)
+        for(size_t n : {256, 1024, 4096, 16384}) {
+            std::vector<NttMod> a = randomMod(NttMod(), 2 * n), b = randomMod(NttMod(), n);
+            b.back() = NttMod(3);
+            auto longDivision = [&] {
+                std::vector<NttMod> r(a), q(n + 1);
+                NttMod leadInv = b.back().inverse();
+                for(size_t i = r.size(); i-- > n - 1;) {
+                    NttMod t = r[i] * leadInv;
+                    q[i - (n - 1)] = t;
+                    for(size_t j = 0; j < n; ++j)
+                        r[i - (n - 1) + j] -= t * b[j];
+                }
+                sinkNtt = std::move(r);
+            };
+            int reps = n <= 1024 ? 5 : 1;
+            double classic = measure(longDivision, reps);
+            double newton = measure([&] { sinkNtt = divideDense(a, b).remainder; }, reps);
+            std::cout << "bölme " << 2 * n << " / " << n << ": long division " << classic << " ms, Newton "
+                      << newton << " ms\n";
+        }
+        std::vector<NttMod> f = randomMod(NttMod(), 1025), x = {NttMod(0), NttMod(1)};
+        double powMs = measure([&] { sinkNtt = powModDense(x, 998244353ull, f); }, 1);
+        std::cout << "x^p mod f (derece 1024): " << powMs << " ms\n";
+    }
+
+    return sinkY.empty() ? 1 : 0;
+}
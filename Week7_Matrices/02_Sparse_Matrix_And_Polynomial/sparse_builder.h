@@ -0,0 +1,168 @@
+#ifndef SPARSE_BUILDER_H
+#define SPARSE_BUILDER_H
+
+#include "sparse_matrix.h"
+#include "compressed_sparse.h"
+#include <vector>
+#include <stdexcept>
+#include <functional>
+#include <cstdint>
+#include <limits>
+
+// Sparse matrix montajı (assembly) için builder.
+// Sırasız (i, j, value) üçlülerini toplu halde toplar, (satır, sütun) anahtarına göre paralel
+// radix sort ile sıralar, aynı konumdaki tekrarları verilen reducer ile birleştirir ve
+// değişmez (immutable) bir CSRMatrix'e dönüştürür.
+template<typename T>
+class SparseMatrixBuilder {
+private:
+    size_t rows;
+    size_t cols;
+    std::vector<uint64_t> keys;  // row * cols + col
+    std::vector<T> values;
+
+    static constexpr size_t RADIX_BITS = 8;
+    static constexpr size_t BUCKETS = size_t(1) << RADIX_BITS;
+
+    uint64_t makeKey(size_t i, size_t j) const {
+        if(i >= rows || j >= cols)
+            throw std::out_of_range("Index out of range");
+        return static_cast<uint64_t>(i) * cols + j;
+    }
+
+    // LSD radix sort (stable): her geçişte thread'ler kendi parçalarının histogramını çıkarır,
+    // global prefix (bucket, thread) sırasıyla alınır ve her thread kendi parçasını scatter eder.
+    // Stable olduğu için aynı anahtarlı üçlüler ekleme sırasını korur.
+    void radixSort(size_t threadCount) {
+        size_t n = keys.size();
+        uint64_t maxKey = static_cast<uint64_t>(rows) * cols;
+        size_t passes = 0;
+        while(passes * RADIX_BITS < 64 && (maxKey >> (passes * RADIX_BITS)) != 0)
+            ++passes;
+
+        threadCount = std::max<size_t>(1, std::min(threadCount, n / 4096 + 1));
+        std::vector<size_t> bounds(threadCount + 1);
+        for(size_t t = 0; t <= threadCount; ++t)
+            bounds[t] = (n * t) / threadCount;
+
+        std::vector<uint64_t> keyBuffer(n);
+        std::vector<T> valueBuffer(n);
+        std::vector<size_t> offsets(threadCount * BUCKETS);
+
+        for(size_t pass = 0; pass < passes; ++pass) {
+            size_t shift = pass * RADIX_BITS;
+            std::fill(offsets.begin(), offsets.end(), 0);
+
+            // Thread başına histogram
+            runIndexed(threadCount, [&](size_t t) {
+                size_t* hist = offsets.data() + t * BUCKETS;
+                for(size_t p = bounds[t]; p < bounds[t + 1]; ++p)
+                    ++hist[(keys[p] >> shift) & (BUCKETS - 1)];
+            });
+
+            // Global exclusive prefix: bucket öncelikli, sonra thread
+            size_t running = 0;
+            for(size_t b = 0; b < BUCKETS; ++b)
+                for(size_t t = 0; t < threadCount; ++t) {
+                    size_t count = offsets[t * BUCKETS + b];
+                    offsets[t * BUCKETS + b] = running;
+                    running += count;
+                }
+
+            // Scatter
+            runIndexed(threadCount, [&](size_t t) {
+                size_t* next = offsets.data() + t * BUCKETS;
+                for(size_t p = bounds[t]; p < bounds[t + 1]; ++p) {
+                    size_t dst = next[(keys[p] >> shift) & (BUCKETS - 1)]++;
+                    keyBuffer[dst] = keys[p];
+                    valueBuffer[dst] = values[p];
+                }
+            });
+            keys.swap(keyBuffer);
+            values.swap(valueBuffer);
+        }
+    }
+
+    // f(0) .. f(count-1) çağrılarını ayrı thread'lerde çalıştırır
+    template<typename F>
+    static void runIndexed(size_t count, F f) {
+        std::vector<size_t> bounds(count + 1);
+        for(size_t t = 0; t <= count; ++t)
+            bounds[t] = t;
+        runPartitioned(bounds, [&](size_t begin, size_t) { f(begin); });
+    }
+
+public:
+    SparseMatrixBuilder(size_t r, size_t c) : rows(r), cols(c) {
+        if(c != 0 && r > std::numeric_limits<uint64_t>::max() / c)
+            throw std::overflow_error("Matrix too large for 64-bit keys");
+    }
+
+    void reserve(size_t count) {
+        keys.reserve(count);
+        values.reserve(count);
+    }
+
+    size_t getRows() const { return rows; }
+    size_t getCols() const { return cols; }
+    size_t getTripletCount() const { return keys.size(); }
+
+    // Tek üçlü ekleme - sırasız ve tekrarlı olabilir
+    void add(size_t i, size_t j, const T& value) {
+        keys.push_back(makeKey(i, j));
+        values.push_back(value);
+    }
+
+    // Toplu ekleme - ayrı satır/sütun/değer dizilerinden
+    void addTriplets(const size_t* rowIdx, const size_t* colIdx, const T* vals, size_t count) {
+        reserve(keys.size() + count);
+        for(size_t p = 0; p < count; ++p) {
+            keys.push_back(makeKey(rowIdx[p], colIdx[p]));
+            values.push_back(vals[p]);
+        }
+    }
+
+    // Toplu ekleme - Element dizisinden (ör. SparseMatrix::getElements())
+    void addTriplets(const std::vector<Element<T>>& elements) {
+        reserve(keys.size() + elements.size());
+        for(const auto& e : elements) {
+            keys.push_back(makeKey(e.row, e.col));
+            values.push_back(e.value);
+        }
+    }
+
+    // Sıralar, tekrarları reducer(birikmiş, yeni) ile ekleme sırasında birleştirir ve CSR'a dondurur.
+    // Birleşik değeri sıfır olan konumlar sonuca eklenmez. Builder sonrasında boşalır.
+    template<typename Reducer = std::plus<T>>
+    CSRMatrix<T> build(Reducer reducer = Reducer(), size_t threadCount = defaultThreadCount()) {
+        radixSort(threadCount);
+
+        std::vector<size_t> rowPtr(rows + 1, 0);
+        std::vector<size_t> colIndex;
+        std::vector<T> vals;
+        colIndex.reserve(keys.size());
+        vals.reserve(keys.size());
+
+        size_t n = keys.size();
+        for(size_t p = 0; p < n;) {
+            uint64_t key = keys[p];
+            T combined = values[p++];
+            while(p < n && keys[p] == key)
+                combined = reducer(combined, values[p++]);
+            if(combined == T())
+                continue;
+            size_t i = static_cast<size_t>(key / cols);
+            colIndex.push_back(static_cast<size_t>(key % cols));
+            vals.push_back(combined);
+            ++rowPtr[i + 1];
+        }
+        for(size_t i = 0; i < rows; ++i)
+            rowPtr[i + 1] += rowPtr[i];
+
+        keys = std::vector<uint64_t>();
+        values = std::vector<T>();
+        return CSRMatrix<T>(rows, cols, std::move(rowPtr), std::move(colIndex), std::move(vals));
+    }
+};
+
+#endif // SPARSE_BUILDER_H
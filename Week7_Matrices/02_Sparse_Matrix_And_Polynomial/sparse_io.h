@@ -0,0 +1,526 @@
+#ifndef SPARSE_IO_H
+#define SPARSE_IO_H
+
+#include "compressed_sparse.h"
+#include "sparse_builder.h"
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <exception>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SPARSE_IO_HAS_MMAP 1
+#endif
+
+// Salt okunur dosya eşlemesi (RAII).
+// POSIX'te mmap kullanılır: sayfalar ihtiyaç oldukça yüklenir, kopya tutulmaz.
+// Diğer platformlarda dosya tek seferde belleğe okunur.
+class MappedFile {
+private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+#ifdef SPARSE_IO_HAS_MMAP
+    void* mapping = nullptr;
+#endif
+    std::vector<char> buffer;
+
+    void release() {
+#ifdef SPARSE_IO_HAS_MMAP
+        if(mapping)
+            munmap(mapping, length);
+        mapping = nullptr;
+#endif
+        buffer.clear();
+        bytes = nullptr;
+        length = 0;
+    }
+
+public:
+    explicit MappedFile(const std::string& path) {
+#ifdef SPARSE_IO_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            throw std::runtime_error("Cannot open file: " + path);
+        struct stat info;
+        if(fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat file: " + path);
+        }
+        length = static_cast<size_t>(info.st_size);
+        if(length > 0) {
+            mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(mapping == MAP_FAILED) {
+                mapping = nullptr;
+                ::close(fd);
+                throw std::runtime_error("Cannot map file: " + path);
+            }
+            madvise(mapping, length, MADV_SEQUENTIAL);
+            bytes = static_cast<const char*>(mapping);
+        }
+        ::close(fd);  // Eşleme fd kapandıktan sonra da geçerlidir
+#else
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if(!file)
+            throw std::runtime_error("Cannot open file: " + path);
+        std::fseek(file, 0, SEEK_END);
+        length = static_cast<size_t>(std::ftell(file));
+        std::fseek(file, 0, SEEK_SET);
+        buffer.resize(length);
+        size_t got = length ? std::fread(buffer.data(), 1, length, file) : 0;
+        std::fclose(file);
+        if(got != length)
+            throw std::runtime_error("Cannot read file: " + path);
+        bytes = buffer.data();
+#endif
+    }
+
+    ~MappedFile() { release(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : bytes(other.bytes), length(other.length),
+#ifdef SPARSE_IO_HAS_MMAP
+          mapping(other.mapping),
+#endif
+          buffer(std::move(other.buffer)) {
+#ifdef SPARSE_IO_HAS_MMAP
+        other.mapping = nullptr;
+#endif
+        if(!buffer.empty())
+            bytes = buffer.data();
+        other.bytes = nullptr;
+        other.length = 0;
+    }
+
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+// ---------------------------------------------------------------------------
+// Matrix Market (.mtx) okuma/yazma
+// Desteklenen: "matrix coordinate" + real/integer/pattern + general/symmetric/skew-symmetric
+// ---------------------------------------------------------------------------
+
+namespace mm_detail {
+
+inline bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+// [pos, end) içinde sonraki satırın başına ilerler
+inline const char* nextLine(const char* pos, const char* end) {
+    const char* nl = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+    return nl ? nl + 1 : end;
+}
+
+// Boşlukları atlayıp bir sayı okur; iostream ve locale kullanmaz
+template<typename V>
+bool parseNumber(const char*& pos, const char* end, V& out) {
+    while(pos < end && isSpace(*pos))
+        ++pos;
+    if(pos < end && *pos == '+')  // from_chars baştaki '+' işaretini kabul etmez
+        ++pos;
+    auto result = std::from_chars(pos, end, out);
+    if(result.ec != std::errc())
+        return false;
+    pos = result.ptr;
+    return true;
+}
+
+inline std::string lowercase(std::string s) {
+    for(char& c : s)
+        if(c >= 'A' && c <= 'Z')
+            c = static_cast<char>(c - 'A' + 'a');
+    return s;
+}
+
+// Bir thread'in parse ettiği üçlüler (0 tabanlı)
+template<typename T>
+struct ParsedChunk {
+    std::vector<size_t> rows;
+    std::vector<size_t> cols;
+    std::vector<T> values;
+    std::exception_ptr error;
+};
+
+} // namespace mm_detail
+
+enum class MatrixMarketSymmetry {
+    General,
+    Symmetric,
+    SkewSymmetric
+};
+
+// .mtx dosyasını CSR olarak okur.
+// Dosya eşlenir (kopya yok), veri bölgesi satır sınırlarından threadCount parçaya bölünür ve
+// her parça from_chars ile ayrı thread'de parse edilir. Üçlüler builder ile paralel radix sort'la
+// sıralanır; simetrik dosyalarda üst üçgen yansıtılır, tekrarlar toplanır.
+template<typename T>
+CSRMatrix<T> readMatrixMarket(const std::string& path, size_t threadCount = defaultThreadCount()) {
+    static_assert(std::is_arithmetic<T>::value, "Matrix Market reader requires an arithmetic type");
+    MappedFile file(path);
+    const char* pos = file.data();
+    const char* end = pos + file.size();
+
+    // Başlık: %%MatrixMarket matrix coordinate <field> <symmetry>
+    const char* headerEnd = mm_detail::nextLine(pos, end);
+    std::string header = mm_detail::lowercase(std::string(pos, headerEnd));
+    char banner[32] = {}, object[32] = {}, format[32] = {}, field[32] = {}, symmetry[32] = {};
+    if(std::sscanf(header.c_str(), "%31s %31s %31s %31s %31s", banner, object, format, field, symmetry) != 5 ||
+       std::string(banner) != "%%matrixmarket" || std::string(object) != "matrix")
+        throw std::runtime_error("Invalid Matrix Market header");
+    if(std::string(format) != "coordinate")
+        throw std::runtime_error("Only coordinate Matrix Market files are supported");
+
+    std::string fieldName(field), symmetryName(symmetry);
+    bool pattern = fieldName == "pattern";
+    if(!pattern && fieldName != "real" && fieldName != "integer" && fieldName != "double")
+        throw std::runtime_error("Unsupported Matrix Market field: " + fieldName);
+    MatrixMarketSymmetry sym;
+    if(symmetryName == "general") sym = MatrixMarketSymmetry::General;
+    else if(symmetryName == "symmetric") sym = MatrixMarketSymmetry::Symmetric;
+    else if(symmetryName == "skew-symmetric") sym = MatrixMarketSymmetry::SkewSymmetric;
+    else throw std::runtime_error("Unsupported Matrix Market symmetry: " + symmetryName);
+
+    // Yorumlar ve boş satırlar, ardından boyut satırı
+    pos = headerEnd;
+    while(pos < end) {
+        const char* p = pos;
+        while(p < end && mm_detail::isSpace(*p))
+            ++p;
+        if(p < end && *p != '%' && *p != '\n')
+            break;
+        pos = mm_detail::nextLine(pos, end);
+    }
+    size_t rows = 0, cols = 0, declared = 0;
+    if(!mm_detail::parseNumber(pos, end, rows) || !mm_detail::parseNumber(pos, end, cols) ||
+       !mm_detail::parseNumber(pos, end, declared))
+        throw std::runtime_error("Invalid Matrix Market size line");
+    pos = mm_detail::nextLine(pos, end);
+
+    // Veri bölgesini satır sınırlarında parçala
+    size_t dataSize = static_cast<size_t>(end - pos);
+    threadCount = std::max<size_t>(1, std::min(threadCount, dataSize / (1 << 16) + 1));
+    std::vector<const char*> cuts(threadCount + 1, end);
+    cuts[0] = pos;
+    for(size_t t = 1; t < threadCount; ++t) {
+        const char* guess = pos + dataSize * t / threadCount;
+        cuts[t] = std::max(cuts[t - 1], guess > pos ? mm_detail::nextLine(guess - 1, end) : pos);
+    }
+
+    std::vector<mm_detail::ParsedChunk<T>> chunks(threadCount);
+    std::vector<size_t> ids(threadCount + 1);
+    for(size_t t = 0; t <= threadCount; ++t)
+        ids[t] = t;
+    runPartitioned(ids, [&](size_t t, size_t) {
+        auto& chunk = chunks[t];
+        try {
+            size_t expected = static_cast<size_t>(cuts[t + 1] - cuts[t]) / 16 + 1;
+            chunk.rows.reserve(expected);
+            chunk.cols.reserve(expected);
+            chunk.values.reserve(expected);
+            const char* p = cuts[t];
+            const char* stop = cuts[t + 1];
+            while(p < stop) {
+                const char* lineEnd = mm_detail::nextLine(p, stop);
+                const char* q = p;
+                while(q < lineEnd && (mm_detail::isSpace(*q) || *q == '\n'))
+                    ++q;
+                if(q == lineEnd || *q == '%') {
+                    p = lineEnd;
+                    continue;
+                }
+                size_t i = 0, j = 0;
+                T value = T(1);
+                if(!mm_detail::parseNumber(q, lineEnd, i) || !mm_detail::parseNumber(q, lineEnd, j) ||
+                   (!pattern && !mm_detail::parseNumber(q, lineEnd, value)))
+                    throw std::runtime_error("Invalid Matrix Market entry");
+                if(i == 0 || j == 0 || i > rows || j > cols)
+                    throw std::out_of_range("Index out of range");
+                chunk.rows.push_back(i - 1);
+                chunk.cols.push_back(j - 1);
+                chunk.values.push_back(value);
+                p = lineEnd;
+            }
+        } catch(...) {
+            chunk.error = std::current_exception();
+        }
+    });
+
+    size_t total = 0;
+    for(const auto& chunk : chunks) {
+        if(chunk.error)
+            std::rethrow_exception(chunk.error);
+        total += chunk.values.size();
+    }
+    if(total != declared)
+        throw std::runtime_error("Matrix Market entry count mismatch");
+
+    // Hızlı yol: writeMatrixMarket gibi (satır, sütun) sıralı ve tekrarsız yazılmış general dosyalar
+    // sıralama yapılmadan doğrudan CSR'a dönüştürülür
+    if(sym == MatrixMarketSymmetry::General) {
+        bool sorted = true;
+        size_t prevRow = 0, prevCol = 0;
+        bool first = true;
+        for(const auto& chunk : chunks) {
+            for(size_t p = 0; p < chunk.values.size() && sorted; ++p) {
+                size_t i = chunk.rows[p], j = chunk.cols[p];
+                if(chunk.values[p] == T() || (!first && (i < prevRow || (i == prevRow && j <= prevCol))))
+                    sorted = false;
+                prevRow = i;
+                prevCol = j;
+                first = false;
+            }
+            if(!sorted)
+                break;
+        }
+        if(sorted) {
+            std::vector<size_t> rowPtr(rows + 1, 0);
+            std::vector<size_t> colIndex;
+            std::vector<T> values;
+            colIndex.reserve(total);
+            values.reserve(total);
+            for(auto& chunk : chunks) {
+                for(size_t i : chunk.rows)
+                    ++rowPtr[i + 1];
+                colIndex.insert(colIndex.end(), chunk.cols.begin(), chunk.cols.end());
+                values.insert(values.end(), chunk.values.begin(), chunk.values.end());
+                chunk = mm_detail::ParsedChunk<T>();
+            }
+            for(size_t i = 0; i < rows; ++i)
+                rowPtr[i + 1] += rowPtr[i];
+            return CSRMatrix<T>(rows, cols, std::move(rowPtr), std::move(colIndex), std::move(values));
+        }
+    }
+
+    SparseMatrixBuilder<T> builder(rows, cols);
+    builder.reserve(sym == MatrixMarketSymmetry::General ? total : 2 * total);
+    for(auto& chunk : chunks) {
+        builder.addTriplets(chunk.rows.data(), chunk.cols.data(), chunk.values.data(), chunk.values.size());
+        if(sym != MatrixMarketSymmetry::General) {
+            T sign = (sym == MatrixMarketSymmetry::SkewSymmetric) ? T(-1) : T(1);
+            for(size_t p = 0; p < chunk.values.size(); ++p)
+                if(chunk.rows[p] != chunk.cols[p])
+                    builder.add(chunk.cols[p], chunk.rows[p], sign * chunk.values[p]);
+        }
+        chunk = mm_detail::ParsedChunk<T>();  // Parça belleğini hemen bırak
+    }
+    return builder.build(std::plus<T>(), threadCount);
+}
+
+// CSR'ı "coordinate general" .mtx olarak yazar; sayılar to_chars ile tampona yazılır
+// (kayan noktalı değerler en kısa, kayıpsız gösterimle)
+template<typename T>
+void writeMatrixMarket(const CSRMatrix<T>& a, const std::string& path) {
+    static_assert(std::is_arithmetic<T>::value, "Matrix Market writer requires an arithmetic type");
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if(!file)
+        throw std::runtime_error("Cannot open file: " + path);
+
+    std::string out = std::string("%%MatrixMarket matrix coordinate ") +
+                      (std::is_integral<T>::value ? "integer" : "real") + " general\n";
+    out += std::to_string(a.getRows()) + " " + std::to_string(a.getCols()) + " " +
+           std::to_string(a.getNonZeroCount()) + "\n";
+
+    const size_t flushSize = 1 << 20;
+    std::vector<char> buffer(flushSize + 128);
+    std::memcpy(buffer.data(), out.data(), out.size());
+    size_t used = out.size();
+    bool ok = true;
+
+    const auto& ptr = a.getRowPointers();
+    const auto& idx = a.getColumnIndices();
+    const auto& val = a.getValues();
+    for(size_t i = 0; i < a.getRows() && ok; ++i)
+        for(size_t p = ptr[i]; p < ptr[i + 1]; ++p) {
+            char* cur = buffer.data() + used;
+            char* last = buffer.data() + buffer.size();
+            cur = std::to_chars(cur, last, i + 1).ptr;
+            *cur++ = ' ';
+            cur = std::to_chars(cur, last, idx[p] + 1).ptr;
+            *cur++ = ' ';
+            cur = std::to_chars(cur, last, val[p]).ptr;
+            *cur++ = '\n';
+            used = static_cast<size_t>(cur - buffer.data());
+            if(used >= flushSize) {
+                ok = std::fwrite(buffer.data(), 1, used, file) == used;
+                used = 0;
+                if(!ok)
+                    break;
+            }
+        }
+    if(ok && used > 0)
+        ok = std::fwrite(buffer.data(), 1, used, file) == used;
+    if(std::fclose(file) != 0 || !ok)
+        throw std::runtime_error("Cannot write file: " + path);
+}
+
+// ---------------------------------------------------------------------------
+// Binary CSR: mmap ile kopyasız açılabilen kompakt format
+// [başlık 40 byte][rowPtr: (rows+1) x u64][colIndex: nnz x u64][values: nnz x T]
+// Tüm bölümler 8 byte hizalıdır; değerler makinenin byte sırasıyla yazılır.
+// ---------------------------------------------------------------------------
+
+struct BinaryCSRHeader {
+    char magic[8];
+    uint32_t valueSize;
+    uint32_t valueKind;  // 0: işaretli tamsayı, 1: işaretsiz tamsayı, 2: kayan noktalı
+    uint64_t rows;
+    uint64_t cols;
+    uint64_t nnz;
+};
+
+static_assert(sizeof(BinaryCSRHeader) == 40, "BinaryCSRHeader must be packed to 40 bytes");
+
+namespace mm_detail {
+
+constexpr char BINARY_CSR_MAGIC[8] = {'C', 'S', 'R', 'B', 'I', 'N', '1', '\0'};
+
+template<typename T>
+constexpr uint32_t valueKind() {
+    return std::is_floating_point<T>::value ? 2u : (std::is_signed<T>::value ? 0u : 1u);
+}
+
+} // namespace mm_detail
+
+template<typename T>
+void writeBinaryCSR(const CSRMatrix<T>& a, const std::string& path) {
+    static_assert(std::is_arithmetic<T>::value, "Binary CSR requires an arithmetic type");
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if(!file)
+        throw std::runtime_error("Cannot open file: " + path);
+
+    BinaryCSRHeader header;
+    std::memcpy(header.magic, mm_detail::BINARY_CSR_MAGIC, sizeof(header.magic));
+    header.valueSize = sizeof(T);
+    header.valueKind = mm_detail::valueKind<T>();
+    header.rows = a.getRows();
+    header.cols = a.getCols();
+    header.nnz = a.getNonZeroCount();
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    auto writeIndices = [&](const std::vector<size_t>& v) {
+        if(sizeof(size_t) == sizeof(uint64_t)) {
+            ok = ok && std::fwrite(v.data(), sizeof(uint64_t), v.size(), file) == v.size();
+        } else {
+            std::vector<uint64_t> wide(v.begin(), v.end());
+            ok = ok && std::fwrite(wide.data(), sizeof(uint64_t), wide.size(), file) == wide.size();
+        }
+    };
+    writeIndices(a.getRowPointers());
+    writeIndices(a.getColumnIndices());
+    const auto& val = a.getValues();
+    ok = ok && std::fwrite(val.data(), sizeof(T), val.size(), file) == val.size();
+    if(std::fclose(file) != 0 || !ok)
+        throw std::runtime_error("Cannot write file: " + path);
+}
+
+// Binary CSR dosyası üzerinde salt okunur görünüm.
+// Açılış yalnızca başlığı ve dosya boyutunu doğrular; diziler doğrudan eşlenmiş sayfalardan okunur (kopya yok).
+// Dizi içeriğine güvenilir (writeBinaryCSR çıktısı varsayılır): bozuk rowPtr/colIndex get ve multiply'da
+// sınır dışı okumaya yol açar. Güvenilmeyen dosyalar için önce validate() çağrılmalıdır.
+template<typename T>
+class CSRMatrixView {
+private:
+    MappedFile file;
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t nnz = 0;
+    const uint64_t* rowPtr = nullptr;
+    const uint64_t* colIndex = nullptr;
+    const T* values = nullptr;
+
+public:
+    explicit CSRMatrixView(const std::string& path) : file(path) {
+        BinaryCSRHeader header;
+        if(file.size() < sizeof(header))
+            throw std::runtime_error("Invalid binary CSR file");
+        std::memcpy(&header, file.data(), sizeof(header));
+        if(std::memcmp(header.magic, mm_detail::BINARY_CSR_MAGIC, sizeof(header.magic)) != 0)
+            throw std::runtime_error("Invalid binary CSR file");
+        if(header.valueSize != sizeof(T) || header.valueKind != mm_detail::valueKind<T>())
+            throw std::runtime_error("Binary CSR value type mismatch");
+        // Boyut hesabı taşmasın: rows ve nnz önce dosyanın alabileceği üst sınırla karşılaştırılır
+        uint64_t payload = file.size() - sizeof(header);
+        if(header.rows >= payload / sizeof(uint64_t) || header.nnz > payload / (sizeof(uint64_t) + sizeof(T)))
+            throw std::runtime_error("Binary CSR file size mismatch");
+        uint64_t expected = (header.rows + 1 + header.nnz) * sizeof(uint64_t) + header.nnz * sizeof(T);
+        if(payload != expected)
+            throw std::runtime_error("Binary CSR file size mismatch");
+
+        rows = static_cast<size_t>(header.rows);
+        cols = static_cast<size_t>(header.cols);
+        nnz = static_cast<size_t>(header.nnz);
+        const char* base = file.data() + sizeof(header);
+        rowPtr = reinterpret_cast<const uint64_t*>(base);
+        colIndex = rowPtr + rows + 1;
+        values = reinterpret_cast<const T*>(colIndex + nnz);
+        if(rowPtr[rows] != nnz)
+            throw std::runtime_error("Invalid binary CSR file");
+    }
+
+    // Dizileri tam tarar - O(rows + nnz): rowPtr 0'dan başlayıp azalmamalı, her satırın sütunları
+    // kesin artan ve < cols olmalıdır. Geçersizse runtime_error fırlatır.
+    void validate() const {
+        if(rowPtr[0] != 0)
+            throw std::runtime_error("Invalid binary CSR file");
+        for(size_t i = 0; i < rows; ++i) {
+            if(rowPtr[i + 1] < rowPtr[i])
+                throw std::runtime_error("Invalid binary CSR file");
+            for(uint64_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                if(colIndex[p] >= cols || (p > rowPtr[i] && colIndex[p] <= colIndex[p - 1]))
+                    throw std::runtime_error("Invalid binary CSR file");
+        }
+    }
+
+    size_t getRows() const { return rows; }
+    size_t getCols() const { return cols; }
+    size_t getNonZeroCount() const { return nnz; }
+
+    const uint64_t* getRowPointers() const { return rowPtr; }
+    const uint64_t* getColumnIndices() const { return colIndex; }
+    const T* getValues() const { return values; }
+
+    // Element alma - satır içinde binary search, O(log k)
+    T get(size_t i, size_t j) const {
+        if(i >= rows || j >= cols)
+            throw std::out_of_range("Index out of range");
+        const uint64_t* first = colIndex + rowPtr[i];
+        const uint64_t* last = colIndex + rowPtr[i + 1];
+        const uint64_t* it = std::lower_bound(first, last, static_cast<uint64_t>(j));
+        if(it != last && *it == j)
+            return values[it - colIndex];
+        return T();
+    }
+
+    // y = A * x - eşlenmiş diziler üzerinde doğrudan
+    std::vector<T> multiply(const std::vector<T>& x) const {
+        if(x.size() != cols)
+            throw std::invalid_argument("Vector size does not match matrix dimensions");
+        std::vector<T> y(rows);
+        for(size_t i = 0; i < rows; ++i) {
+            T sum = T();
+            for(uint64_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                sum += values[p] * x[colIndex[p]];
+            y[i] = sum;
+        }
+        return y;
+    }
+
+    // Belleğe kopyalanmış, değiştirilebilir CSR
+    CSRMatrix<T> toCSR() const {
+        return CSRMatrix<T>(rows, cols, std::vector<size_t>(rowPtr, rowPtr + rows + 1),
+                            std::vector<size_t>(colIndex, colIndex + nnz), std::vector<T>(values, values + nnz));
+    }
+};
+
+#endif // SPARSE_IO_H
@@ -1,10 +1,15 @@
 #ifndef SPARSE_MATRIX_H
 #define SPARSE_MATRIX_H
 
+#include "poly_multiply.h"
+#include "poly_division.h"
+#include "poly_evaluate.h"
 #include <vector>
 #include <map>
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
+#include <cmath>
 
 // Sparse matrix için element yapısı
 template<typename T>
@@ -61,6 +66,37 @@ public:
     size_t getCols() const { return cols; }
     size_t getNonZeroCount() const { return elements.size(); }
     
+    // Sıfır olmayan elementler - ekleme sırasıyla (format dönüşümleri için)
+    const std::vector<Element<T>>& getElements() const { return elements; }
+    
+    // Fast transpose - sütunlara göre counting sort, O(nnz + cols)
+    // Sonuçta elementler (satır, sütun) sırasına göre dizilidir
+    SparseMatrix transpose() const {
+        std::vector<size_t> start(cols + 1, 0);
+        for(const auto& elem : elements)
+            ++start[elem.col + 1];
+        for(size_t j = 0; j < cols; ++j)
+            start[j + 1] += start[j];
+        
+        // Önce satıra göre stable sırala ki transpozda her satır içi sütunlar sıralı olsun
+        std::vector<size_t> byRow(rows + 1, 0);
+        for(const auto& elem : elements)
+            ++byRow[elem.row + 1];
+        for(size_t i = 0; i < rows; ++i)
+            byRow[i + 1] += byRow[i];
+        std::vector<size_t> order(elements.size());
+        for(size_t p = 0; p < elements.size(); ++p)
+            order[byRow[elements[p].row]++] = p;
+        
+        SparseMatrix result(cols, rows);
+        result.elements.assign(elements.size(), Element<T>(0, 0, T()));
+        for(size_t p : order) {
+            const Element<T>& elem = elements[p];
+            result.elements[start[elem.col]++] = Element<T>(elem.col, elem.row, elem.value);
+        }
+        return result;
+    }
+    
     // Matrix'i ekrana yazdır
     void display() const {
         std::map<std::pair<size_t,size_t>, T> elemMap;
@@ -81,38 +117,236 @@ public:
     }
 };
 
-// Polynomial sınıfı - sparse vector olarak temsil edilir
+// Polynomial saklama biçimi
+enum class PolynomialStorage {
+    Sparse,  // {üs: katsayı} map'i - yüksek dereceli, az terimli polinomlar
+    Dense    // katsayı vektörü, coeffs[k] = x^k katsayısı
+};
+
+// Doluluk oranı (terim sayısı / (derece + 1)) eşikleri. Aradaki boşluk (histerezis)
+// tek terim ekleyip silerken biçimler arasında gidip gelmeyi önler.
+constexpr double POLY_DENSE_FILL = 0.25;
+constexpr double POLY_SPARSE_FILL = 0.125;
+// Sparse çarpımda heap merge işi (t_a t_b log min(t_a, t_b)) sonuç uzunluğunun bu katını aşarsa
+// yoğun çarpıma geçilir (sparse_benchmark "sparse/dense crossover" bölümü)
+constexpr double POLY_SPARSE_MULTIPLY_CROSSOVER = 64.0;
+
+// Polynomial sınıfı - doluluk oranına göre otomatik olarak sparse (map) veya dense (vektör) saklanır
 template<typename T>
 class Polynomial {
 private:
-    std::map<size_t, T> coefficients;  // {üs: katsayı} şeklinde
+    std::map<size_t, T> coefficients;  // Sparse: {üs: katsayı} şeklinde
+    std::vector<T> dense;              // Dense: sondaki sıfırlar kırpılmış katsayılar
+    PolynomialStorage storage;
     size_t degree;
+    size_t terms;                      // Sıfır olmayan terim sayısı
+
+    double fillRatio() const {
+        return static_cast<double>(terms) / static_cast<double>(degree + 1);
+    }
+
+    void toSparseStorage() {
+        coefficients.clear();
+        for(size_t k = 0; k < dense.size(); ++k)
+            if(dense[k] != T())
+                coefficients.emplace_hint(coefficients.end(), k, dense[k]);
+        dense = std::vector<T>();
+        storage = PolynomialStorage::Sparse;
+    }
+
+    void toDenseStorage() {
+        dense.assign(terms ? degree + 1 : 0, T());
+        for(const auto& term : coefficients)
+            dense[term.first] = term.second;
+        coefficients.clear();
+        storage = PolynomialStorage::Dense;
+    }
+
+    // Derece değişimi sonrası doluluğa göre biçim seçimi
+    void rebalance() {
+        if(storage == PolynomialStorage::Sparse && terms > 0 && fillRatio() >= POLY_DENSE_FILL)
+            toDenseStorage();
+        else if(storage == PolynomialStorage::Dense && fillRatio() < POLY_SPARSE_FILL)
+            toSparseStorage();
+    }
+
+    // Dense vektörde sondaki sıfırları kırpıp dereceyi günceller
+    void trimDense() {
+        while(!dense.empty() && dense.back() == T())
+            dense.pop_back();
+        degree = dense.empty() ? 0 : dense.size() - 1;
+    }
 
 public:
     // Constructor - default olarak sabit polinom (derece 0)
-    Polynomial() : degree(0) {}
-    
-    // Terim ekleme
+    Polynomial() : storage(PolynomialStorage::Sparse), degree(0), terms(0) {}
+
+    // Yoğun katsayı vektöründen oluşturma (coeffs[k] = x^k katsayısı)
+    static Polynomial fromCoefficients(std::vector<T> coeffs) {
+        Polynomial result;
+        result.dense = std::move(coeffs);
+        result.storage = PolynomialStorage::Dense;
+        result.trimDense();
+        result.terms = 0;
+        for(const T& c : result.dense)
+            if(c != T())
+                ++result.terms;
+        result.rebalance();
+        return result;
+    }
+
+    // Terim ekleme - power üssünün katsayısını coeff yapar (sıfır katsayı terimi siler)
     void addTerm(size_t power, const T& coeff) {
-        if(coeff != T()) {  // Sıfır katsayılı terim ekleme
-            coefficients[power] = coeff;
+        if(storage == PolynomialStorage::Dense) {
+            if(power >= dense.size()) {
+                if(coeff == T())
+                    return;
+                // Yeni derece polinomu fazla seyrekleştirecekse önce sparse'a geç
+                if(static_cast<double>(terms + 1) / static_cast<double>(power + 1) < POLY_SPARSE_FILL) {
+                    toSparseStorage();
+                } else {
+                    dense.resize(power + 1, T());
+                    dense[power] = coeff;
+                    degree = power;
+                    ++terms;
+                    return;
+                }
+            } else {
+                if(dense[power] == T() && coeff != T()) ++terms;
+                if(dense[power] != T() && coeff == T()) --terms;
+                dense[power] = coeff;
+                trimDense();
+                rebalance();
+                return;
+            }
+        }
+
+        if(coeff != T()) {  // Sıfır katsayılı terim saklanmaz
+            auto inserted = coefficients.insert_or_assign(power, coeff);
+            if(inserted.second)
+                ++terms;
             degree = std::max(degree, power);
+        } else if(coefficients.erase(power)) {
+            --terms;
+            degree = coefficients.empty() ? 0 : coefficients.rbegin()->first;
         }
+        rebalance();
     }
     
     // Katsayı alma
     T getCoefficient(size_t power) const {
+        if(storage == PolynomialStorage::Dense)
+            return power < dense.size() ? dense[power] : T();
         auto it = coefficients.find(power);
         return (it != coefficients.end()) ? it->second : T();
     }
     
     // Polinom derecesini getir
     size_t getDegree() const { return degree; }
+
+    size_t getTermCount() const { return terms; }
+    PolynomialStorage getStorage() const { return storage; }
+    bool isZero() const { return terms == 0; }
+
+    // Biçimi zorla değiştirir (ör. benchmark için); sonraki değişiklikler yine otomatik seçer
+    void convertTo(PolynomialStorage target) {
+        if(target == storage)
+            return;
+        if(target == PolynomialStorage::Dense)
+            toDenseStorage();
+        else
+            toSparseStorage();
+    }
+
+    // Sıfır olmayan terimleri artan üs sırasıyla f(üs, katsayı) ile gezer
+    template<typename F>
+    void forEachTerm(F f) const {
+        if(storage == PolynomialStorage::Dense) {
+            for(size_t k = 0; k < dense.size(); ++k)
+                if(dense[k] != T())
+                    f(k, dense[k]);
+        } else {
+            for(const auto& term : coefficients)
+                f(term.first, term.second);
+        }
+    }
+
+    // Artan üs sırasıyla (üs, katsayı) çiftleri
+    std::vector<std::pair<size_t, T>> getTerms() const {
+        std::vector<std::pair<size_t, T>> result;
+        result.reserve(terms);
+        forEachTerm([&](size_t power, const T& coeff) { result.emplace_back(power, coeff); });
+        return result;
+    }
+
+    // Yoğun katsayı vektörü (derece + 1 eleman; sıfır polinom için boş)
+    std::vector<T> toDense() const {
+        if(storage == PolynomialStorage::Dense)
+            return dense;
+        std::vector<T> result(terms ? degree + 1 : 0, T());
+        for(const auto& term : coefficients)
+            result[term.first] = term.second;
+        return result;
+    }
     
+    // p(x) - dense: Horner; sparse: terimler azalan sırada, aradaki üs farkı kare alma ile
+    T evaluate(const T& x) const {
+        if(storage == PolynomialStorage::Dense)
+            return hornerEvaluate(dense.data(), dense.size(), x);
+        T acc = T();
+        size_t previous = degree;
+        for(auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+            acc = acc * poly_detail::power(x, previous - it->first) + it->second;
+            previous = it->first;
+        }
+        return acc * poly_detail::power(x, previous);
+    }
+
+    // p(x) - Estrin şeması (dense katsayılar üzerinde; kısa bağımlılık zinciri)
+    T evaluateEstrin(const T& x) const {
+        if(storage == PolynomialStorage::Dense)
+            return estrinEvaluate(dense.data(), dense.size(), x);
+        std::vector<T> coeffs = toDense();
+        return estrinEvaluate(coeffs.data(), coeffs.size(), x);
+    }
+
+    // out[j] = p(xs[j]), j < count.
+    // Kayan noktalı olmayan tiplerde yüksek derece ve çok sayıda noktada subproduct tree,
+    // diğer durumlarda noktalar arasında vektörlenen Horner kullanılır.
+    // Ağaç katsayıları p(x)'in kendisi taşmasa da taşar: işaretli tamsayılarda ağaç aynı genişlikteki
+    // işaretsiz tipte (Z/2^bit, taşma tanımlı) kurulur ve sonuç geri çevrilir.
+    void evaluate(const T* xs, size_t count, T* out) const {
+        if(storage == PolynomialStorage::Sparse) {
+            for(size_t j = 0; j < count; ++j)
+                out[j] = evaluate(xs[j]);
+            return;
+        }
+        if(std::is_floating_point<T>::value || degree < MULTIPOINT_THRESHOLD || count <= degree) {
+            evaluateBatch(dense.data(), dense.size(), xs, count, out);
+            return;
+        }
+        if constexpr(std::is_integral<T>::value && std::is_signed<T>::value) {
+            using U = std::make_unsigned_t<T>;
+            std::vector<U> ring(dense.begin(), dense.end()), points(xs, xs + count), values(count);
+            evaluateMultipoint(ring, points.data(), count, values.data());
+            for(size_t j = 0; j < count; ++j)
+                out[j] = static_cast<T>(values[j]);
+        } else {
+            evaluateMultipoint(dense, xs, count, out);
+        }
+    }
+
+    std::vector<T> evaluate(const std::vector<T>& xs) const {
+        std::vector<T> out(xs.size());
+        evaluate(xs.data(), xs.size(), out.data());
+        return out;
+    }
+
     // Polinomu ekrana yazdır
     void display() const {
         bool first = true;
-        for(auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+        std::vector<std::pair<size_t, T>> all = getTerms();
+        for(auto it = all.rbegin(); it != all.rend(); ++it) {
             if(!first && it->second > T()) std::cout << "+";
             first = false;
             
@@ -131,38 +365,106 @@ public:
     
     // Polynomial toplama
     Polynomial operator+(const Polynomial& other) const {
-        Polynomial result;
-        
-        // This polinomunun terimlerini ekle
-        for(const auto& term : coefficients) {
-            result.addTerm(term.first, term.second);
+        // İki dense polinom: vektör toplamı
+        if(storage == PolynomialStorage::Dense && other.storage == PolynomialStorage::Dense) {
+            std::vector<T> sum(std::max(dense.size(), other.dense.size()), T());
+            for(size_t k = 0; k < dense.size(); ++k)
+                sum[k] += dense[k];
+            for(size_t k = 0; k < other.dense.size(); ++k)
+                sum[k] += other.dense[k];
+            return fromCoefficients(std::move(sum));
         }
-        
-        // Other polinomunun terimlerini ekle
-        for(const auto& term : other.coefficients) {
-            T sum = result.getCoefficient(term.first) + term.second;
-            result.addTerm(term.first, sum);
+
+        // Diğer durumlar: iki sıralı terim dizisinin lineer merge'ü, sonuç sona eklenerek kurulur
+        std::vector<std::pair<size_t, T>> a = getTerms(), b = other.getTerms();
+        Polynomial result;
+        size_t i = 0, j = 0;
+        auto append = [&](size_t power, const T& coeff) {
+            if(coeff == T())
+                return;
+            result.coefficients.emplace_hint(result.coefficients.end(), power, coeff);
+            result.degree = power;
+            ++result.terms;
+        };
+        while(i < a.size() || j < b.size()) {
+            if(j == b.size() || (i < a.size() && a[i].first < b[j].first)) {
+                append(a[i].first, a[i].second);
+                ++i;
+            } else if(i == a.size() || b[j].first < a[i].first) {
+                append(b[j].first, b[j].second);
+                ++j;
+            } else {
+                append(a[i].first, a[i].second + b[j].second);
+                ++i;
+                ++j;
+            }
         }
-        
+        result.rebalance();
         return result;
     }
     
     // Polynomial çarpma
     Polynomial operator*(const Polynomial& other) const {
+        if(isZero() || other.isZero())
+            return Polynomial();
+
+        // İki dense polinom: boyuta göre schoolbook / Karatsuba / FFT-NTT
+        if(storage == PolynomialStorage::Dense && other.storage == PolynomialStorage::Dense)
+            return fromCoefficients(multiplyDense(dense, other.dense));
+
+        // Sparse operand: terim çarpımları sonuç uzunluğuna göre çoksa yine yoğun çarpım daha ucuzdur
+        double shortTerms = static_cast<double>(std::min(terms, other.terms));
+        double heapWork = static_cast<double>(terms) * static_cast<double>(other.terms) * std::log2(shortTerms + 1);
+        if(heapWork > POLY_SPARSE_MULTIPLY_CROSSOVER * static_cast<double>(degree + other.degree + 1))
+            return fromCoefficients(multiplyDense(toDense(), other.toDense()));
+
+        // Heap merge: sonuç artan üs sırasıyla üretilir, map'e yalnızca sona ekleme yapılır
         Polynomial result;
-        
-        // Her terimi diğer polinomun her terimi ile çarp
-        for(const auto& term1 : coefficients) {
-            for(const auto& term2 : other.coefficients) {
-                size_t power = term1.first + term2.first;
-                T coeff = term1.second * term2.second;
-                T sum = result.getCoefficient(power) + coeff;
-                result.addTerm(power, sum);
-            }
-        }
-        
+        for(auto& term : multiplySparseTerms(getTerms(), other.getTerms()))
+            result.coefficients.emplace_hint(result.coefficients.end(), term.first, std::move(term.second));
+        result.terms = result.coefficients.size();
+        result.degree = result.coefficients.empty() ? 0 : result.coefficients.rbegin()->first;
+        result.rebalance();
         return result;
     }
+
+    // Polynomial çıkarma - a - b = a + (-1) b
+    Polynomial operator-(const Polynomial& other) const {
+        Polynomial negated = other;
+        if(negated.storage == PolynomialStorage::Dense) {
+            for(auto& c : negated.dense)
+                c = -c;
+        } else {
+            for(auto& term : negated.coefficients)
+                term.second = -term.second;
+        }
+        return *this + negated;
+    }
+
+    bool operator==(const Polynomial& other) const {
+        return terms == other.terms && degree == other.degree && getTerms() == other.getTerms();
+    }
+    bool operator!=(const Polynomial& other) const { return !(*this == other); }
+
+    // Kalanlı bölme: *this = divisor * first + second, deg second < deg divisor.
+    // Bölenin baş katsayısı terslenebilir olmalı (double, ModInt; tamsayılarda ±1).
+    std::pair<Polynomial, Polynomial> divide(const Polynomial& divisor) const {
+        PolyDivisionResult<T> division = divideDense(toDense(), divisor.toDense());
+        return {fromCoefficients(std::move(division.quotient)), fromCoefficients(std::move(division.remainder))};
+    }
+
+    Polynomial operator/(const Polynomial& divisor) const { return divide(divisor).first; }
+    Polynomial operator%(const Polynomial& divisor) const { return divide(divisor).second; }
+
+    // this^exponent mod modulus - tekrarlı kare alma, her adımda hızlı çarpım + Newton indirgemesi
+    Polynomial powMod(uint64_t exponent, const Polynomial& modulus) const {
+        return fromCoefficients(powModDense(toDense(), exponent, modulus.toDense()));
+    }
+
+    // Monik en büyük ortak bölen (Öklid); katsayılar bir cisim üzerinde olmalıdır
+    static Polynomial gcd(const Polynomial& a, const Polynomial& b) {
+        return fromCoefficients(gcdDense(a.toDense(), b.toDense()));
+    }
 };
 
 #endif // SPARSE_MATRIX_H 
\ No newline at end of file
@@ -0,0 +1,418 @@
+#ifndef SPARSE_SOLVERS_H
+#define SPARSE_SOLVERS_H
+
+#include "compressed_sparse.h"
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+// Büyük sparse sistemler (Ax = b) için Krylov alt uzayı çözücüleri: CG, BiCGSTAB, GMRES(m).
+// Tüm vektör işlemleri (SpMV, dot, axpy) aynı thread sayısıyla bölünerek çalışır.
+
+// ---------------------------------------------------------------------------
+// Paralel vektör çekirdekleri
+// ---------------------------------------------------------------------------
+
+// Thread başına en az bu kadar eleman yoksa thread açmanın maliyeti kazancı geçer
+constexpr size_t VECTOR_GRAIN = 32768;
+
+// [0, n) aralığını eşit parçalara bölen sınırlar
+inline std::vector<size_t> evenPartition(size_t n, size_t parts) {
+    parts = std::max<size_t>(1, std::min(parts, n / VECTOR_GRAIN + 1));
+    std::vector<size_t> bounds(parts + 1);
+    for(size_t t = 0; t <= parts; ++t)
+        bounds[t] = (n * t) / parts;
+    return bounds;
+}
+
+// a · b
+template<typename T>
+T dot(const std::vector<T>& a, const std::vector<T>& b, size_t threadCount = 1) {
+    std::vector<size_t> bounds = evenPartition(a.size(), threadCount);
+    std::vector<T> partial(bounds.size() - 1, T());
+    // Parçalar indeksle dağıtılır; her thread kendi kısmi toplamını yazar
+    std::vector<size_t> ids(bounds.size());
+    for(size_t t = 0; t < ids.size(); ++t)
+        ids[t] = t;
+    runPartitioned(ids, [&](size_t t, size_t) {
+        T sum = T();
+        for(size_t i = bounds[t]; i < bounds[t + 1]; ++i)
+            sum += a[i] * b[i];
+        partial[t] = sum;
+    });
+    T sum = T();
+    for(const T& p : partial)
+        sum += p;
+    return sum;
+}
+
+template<typename T>
+T norm2(const std::vector<T>& a, size_t threadCount = 1) {
+    return std::sqrt(dot(a, a, threadCount));
+}
+
+// y = y + alpha * x
+template<typename T>
+void axpy(T alpha, const std::vector<T>& x, std::vector<T>& y, size_t threadCount = 1) {
+    runPartitioned(evenPartition(y.size(), threadCount), [&](size_t begin, size_t end) {
+        for(size_t i = begin; i < end; ++i)
+            y[i] += alpha * x[i];
+    });
+}
+
+// y = x + beta * y
+template<typename T>
+void xpby(const std::vector<T>& x, T beta, std::vector<T>& y, size_t threadCount = 1) {
+    runPartitioned(evenPartition(y.size(), threadCount), [&](size_t begin, size_t end) {
+        for(size_t i = begin; i < end; ++i)
+            y[i] = x[i] + beta * y[i];
+    });
+}
+
+// ---------------------------------------------------------------------------
+// Preconditioner'lar: apply(r, z) -> z = M^{-1} r
+// ---------------------------------------------------------------------------
+
+template<typename T>
+class IdentityPreconditioner {
+public:
+    void apply(const std::vector<T>& r, std::vector<T>& z, size_t = 1) const { z = r; }
+};
+
+// Jacobi: M = diag(A)
+template<typename T>
+class JacobiPreconditioner {
+private:
+    std::vector<T> inverseDiagonal;
+
+public:
+    explicit JacobiPreconditioner(const CSRMatrix<T>& a) : inverseDiagonal(a.getRows()) {
+        if(a.getRows() != a.getCols())
+            throw std::invalid_argument("Matrix must be square");
+        for(size_t i = 0; i < a.getRows(); ++i) {
+            T d = a.get(i, i);
+            if(d == T())
+                throw std::runtime_error("Zero diagonal in Jacobi preconditioner");
+            inverseDiagonal[i] = T(1) / d;
+        }
+    }
+
+    void apply(const std::vector<T>& r, std::vector<T>& z, size_t threadCount = 1) const {
+        z.resize(r.size());
+        runPartitioned(evenPartition(r.size(), threadCount), [&](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
+                z[i] = inverseDiagonal[i] * r[i];
+        });
+    }
+};
+
+// ILU(0): A'nın sparsity pattern'i üzerinde eksik LU (L birim alt üçgen, U üst üçgen aynı dizide).
+// Faktörizasyon IKJ sırasıyla, satır pozisyonları marker dizisiyle bulunarak O(nnz · satır uzunluğu).
+// Uygulama ileri/geri yerine koyma olduğu için sıralıdır.
+template<typename T>
+class ILU0Preconditioner {
+private:
+    size_t n;
+    std::vector<size_t> rowPtr;
+    std::vector<size_t> colIndex;
+    std::vector<T> values;       // L (köşegen altı) ve U (köşegen ve üstü)
+    std::vector<size_t> diagPos;
+
+public:
+    explicit ILU0Preconditioner(const CSRMatrix<T>& a)
+        : n(a.getRows()), rowPtr(a.getRowPointers()), colIndex(a.getColumnIndices()),
+          values(a.getValues()), diagPos(a.getRows()) {
+        if(a.getRows() != a.getCols())
+            throw std::invalid_argument("Matrix must be square");
+        const size_t none = static_cast<size_t>(-1);
+        for(size_t i = 0; i < n; ++i) {
+            auto first = colIndex.begin() + rowPtr[i];
+            auto last = colIndex.begin() + rowPtr[i + 1];
+            auto it = std::lower_bound(first, last, i);
+            if(it == last || *it != i)
+                throw std::runtime_error("ILU(0) requires a stored diagonal");
+            diagPos[i] = it - colIndex.begin();
+        }
+
+        std::vector<size_t> position(n, none);
+        for(size_t i = 0; i < n; ++i) {
+            for(size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                position[colIndex[p]] = p;
+            for(size_t p = rowPtr[i]; p < diagPos[i]; ++p) {
+                size_t k = colIndex[p];
+                values[p] /= values[diagPos[k]];
+                T factor = values[p];
+                for(size_t q = diagPos[k] + 1; q < rowPtr[k + 1]; ++q) {
+                    size_t target = position[colIndex[q]];
+                    if(target != none)
+                        values[target] -= factor * values[q];
+                }
+            }
+            if(values[diagPos[i]] == T())
+                throw std::runtime_error("Zero pivot in ILU(0)");
+            for(size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                position[colIndex[p]] = none;
+        }
+    }
+
+    // z = U^{-1} L^{-1} r
+    void apply(const std::vector<T>& r, std::vector<T>& z, size_t = 1) const {
+        z.resize(n);
+        for(size_t i = 0; i < n; ++i) {
+            T sum = r[i];
+            for(size_t p = rowPtr[i]; p < diagPos[i]; ++p)
+                sum -= values[p] * z[colIndex[p]];
+            z[i] = sum;
+        }
+        for(size_t i = n; i-- > 0;) {
+            T sum = z[i];
+            for(size_t p = diagPos[i] + 1; p < rowPtr[i + 1]; ++p)
+                sum -= values[p] * z[colIndex[p]];
+            z[i] = sum / values[diagPos[i]];
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Çözücüler
+// ---------------------------------------------------------------------------
+
+struct SolverOptions {
+    double tolerance = 1e-8;       // ||r|| / ||b|| için hedef
+    size_t maxIterations = 1000;
+    size_t restart = 30;           // GMRES(m) için m
+    size_t threads = 1;
+    // Her iterasyonda (iterasyon, göreli residual) ile çağrılır; false dönerse çözüm durdurulur
+    std::function<bool(size_t, double)> callback;
+};
+
+struct SolverResult {
+    bool converged = false;
+    size_t iterations = 0;
+    double residual = 0;           // son göreli residual
+};
+
+namespace solver_detail {
+
+inline bool notify(const SolverOptions& options, size_t iteration, double residual) {
+    return !options.callback || options.callback(iteration, residual);
+}
+
+template<typename T>
+void checkSystem(const CSRMatrix<T>& a, const std::vector<T>& b, std::vector<T>& x) {
+    if(a.getRows() != a.getCols())
+        throw std::invalid_argument("Matrix must be square");
+    if(b.size() != a.getRows())
+        throw std::invalid_argument("Vector size does not match matrix dimensions");
+    if(x.size() != b.size())
+        x.assign(b.size(), T());
+}
+
+} // namespace solver_detail
+
+// Preconditioned Conjugate Gradient - A simetrik pozitif tanımlı olmalı
+// x başlangıç tahminidir (boyutu uymuyorsa sıfırdan başlar)
+template<typename T, typename Preconditioner = IdentityPreconditioner<T>>
+SolverResult conjugateGradient(const CSRMatrix<T>& a, const std::vector<T>& b, std::vector<T>& x,
+                               const Preconditioner& m = Preconditioner(),
+                               const SolverOptions& options = SolverOptions()) {
+    solver_detail::checkSystem(a, b, x);
+    size_t threads = options.threads;
+    SolverResult result;
+    double bNorm = norm2(b, threads);
+    if(bNorm == 0) bNorm = 1;
+
+    std::vector<T> r(b), z, p, ap;
+    a.multiplyInto(x, ap, threads);
+    axpy(T(-1), ap, r, threads);
+    m.apply(r, z, threads);
+    p = z;
+    T rz = dot(r, z, threads);
+    result.residual = norm2(r, threads) / bNorm;
+
+    while(result.residual > options.tolerance && result.iterations < options.maxIterations) {
+        a.multiplyInto(p, ap, threads);
+        T pAp = dot(p, ap, threads);
+        if(pAp == T())
+            break;
+        T alpha = rz / pAp;
+        axpy(alpha, p, x, threads);
+        axpy(-alpha, ap, r, threads);
+        ++result.iterations;
+        result.residual = norm2(r, threads) / bNorm;
+        if(!solver_detail::notify(options, result.iterations, result.residual))
+            break;
+        if(result.residual <= options.tolerance)
+            break;
+        m.apply(r, z, threads);
+        T rzNew = dot(r, z, threads);
+        xpby(z, rzNew / rz, p, threads);  // p = z + beta * p
+        rz = rzNew;
+    }
+    result.converged = result.residual <= options.tolerance;
+    return result;
+}
+
+// Preconditioned BiCGSTAB (sağdan preconditioning) - simetrik olmayan sistemler için
+template<typename T, typename Preconditioner = IdentityPreconditioner<T>>
+SolverResult biCGSTAB(const CSRMatrix<T>& a, const std::vector<T>& b, std::vector<T>& x,
+                      const Preconditioner& m = Preconditioner(),
+                      const SolverOptions& options = SolverOptions()) {
+    solver_detail::checkSystem(a, b, x);
+    size_t threads = options.threads;
+    SolverResult result;
+    double bNorm = norm2(b, threads);
+    if(bNorm == 0) bNorm = 1;
+
+    size_t n = b.size();
+    std::vector<T> r(b), v(n, T()), p(n, T()), s, t, pHat, sHat, tmp;
+    a.multiplyInto(x, tmp, threads);
+    axpy(T(-1), tmp, r, threads);
+    std::vector<T> rHat = r;  // gölge residual
+    T rho = 1, alpha = 1, omega = 1;
+    result.residual = norm2(r, threads) / bNorm;
+
+    while(result.residual > options.tolerance && result.iterations < options.maxIterations) {
+        T rhoNew = dot(rHat, r, threads);
+        if(rhoNew == T())
+            break;  // breakdown
+        T beta = (rhoNew / rho) * (alpha / omega);
+        rho = rhoNew;
+        // p = r + beta * (p - omega * v)
+        axpy(-omega, v, p, threads);
+        xpby(r, beta, p, threads);
+        m.apply(p, pHat, threads);
+        a.multiplyInto(pHat, v, threads);
+        T rHatV = dot(rHat, v, threads);
+        if(rHatV == T())
+            break;
+        alpha = rho / rHatV;
+        s = r;
+        axpy(-alpha, v, s, threads);
+        axpy(alpha, pHat, x, threads);
+        ++result.iterations;
+        double sNorm = norm2(s, threads) / bNorm;
+        if(sNorm <= options.tolerance) {
+            result.residual = sNorm;
+            solver_detail::notify(options, result.iterations, result.residual);
+            break;
+        }
+        m.apply(s, sHat, threads);
+        a.multiplyInto(sHat, t, threads);
+        T tt = dot(t, t, threads);
+        omega = tt == T() ? T() : dot(t, s, threads) / tt;
+        axpy(omega, sHat, x, threads);
+        r = s;
+        axpy(-omega, t, r, threads);
+        result.residual = norm2(r, threads) / bNorm;
+        if(!solver_detail::notify(options, result.iterations, result.residual))
+            break;
+        if(omega == T())
+            break;
+    }
+    result.converged = result.residual <= options.tolerance;
+    return result;
+}
+
+// Restarted GMRES(m) - sağdan preconditioning, Arnoldi (modified Gram-Schmidt) + Givens rotasyonları
+template<typename T, typename Preconditioner = IdentityPreconditioner<T>>
+SolverResult gmres(const CSRMatrix<T>& a, const std::vector<T>& b, std::vector<T>& x,
+                   const Preconditioner& m = Preconditioner(),
+                   const SolverOptions& options = SolverOptions()) {
+    solver_detail::checkSystem(a, b, x);
+    if(options.restart == 0)
+        throw std::invalid_argument("GMRES restart must be positive");
+    size_t threads = options.threads;
+    size_t restart = options.restart;
+    SolverResult result;
+    double bNorm = norm2(b, threads);
+    if(bNorm == 0) bNorm = 1;
+
+    size_t n = b.size();
+    std::vector<std::vector<T>> basis(restart + 1, std::vector<T>(n));
+    std::vector<std::vector<T>> h(restart + 1, std::vector<T>(restart, T()));  // Hessenberg
+    std::vector<T> cs(restart), sn(restart), g(restart + 1);
+    std::vector<T> r, w, z;
+
+    auto computeResidual = [&]() {
+        a.multiplyInto(x, w, threads);
+        r = b;
+        axpy(T(-1), w, r, threads);
+        return norm2(r, threads);
+    };
+
+    double beta = computeResidual();
+    result.residual = beta / bNorm;
+    bool stop = false;
+    while(!stop && result.residual > options.tolerance && result.iterations < options.maxIterations) {
+        for(size_t i = 0; i < n; ++i)
+            basis[0][i] = r[i] / static_cast<T>(beta);
+        std::fill(g.begin(), g.end(), T());
+        g[0] = static_cast<T>(beta);
+
+        size_t k = 0;
+        for(; k < restart && result.iterations < options.maxIterations; ++k) {
+            m.apply(basis[k], z, threads);
+            a.multiplyInto(z, w, threads);
+            for(size_t j = 0; j <= k; ++j) {
+                h[j][k] = dot(w, basis[j], threads);
+                axpy(-h[j][k], basis[j], w, threads);
+            }
+            h[k + 1][k] = norm2(w, threads);
+            if(h[k + 1][k] != T())
+                for(size_t i = 0; i < n; ++i)
+                    basis[k + 1][i] = w[i] / h[k + 1][k];
+
+            // Önceki rotasyonları yeni sütuna uygula, yeni rotasyonu hesapla
+            for(size_t j = 0; j < k; ++j) {
+                T temp = cs[j] * h[j][k] + sn[j] * h[j + 1][k];
+                h[j + 1][k] = -sn[j] * h[j][k] + cs[j] * h[j + 1][k];
+                h[j][k] = temp;
+            }
+            T denom = std::sqrt(h[k][k] * h[k][k] + h[k + 1][k] * h[k + 1][k]);
+            cs[k] = denom == T() ? T(1) : h[k][k] / denom;
+            sn[k] = denom == T() ? T() : h[k + 1][k] / denom;
+            h[k][k] = denom;
+            h[k + 1][k] = T();
+            g[k + 1] = -sn[k] * g[k];
+            g[k] = cs[k] * g[k];
+
+            ++result.iterations;
+            result.residual = std::abs(static_cast<double>(g[k + 1])) / bNorm;
+            if(!solver_detail::notify(options, result.iterations, result.residual)) {
+                stop = true;
+                ++k;
+                break;
+            }
+            if(result.residual <= options.tolerance) {
+                ++k;
+                break;
+            }
+        }
+
+        // H y = g (üst üçgen), x += M^{-1} V y
+        std::vector<T> y(k);
+        for(size_t i = k; i-- > 0;) {
+            T sum = g[i];
+            for(size_t j = i + 1; j < k; ++j)
+                sum -= h[i][j] * y[j];
+            y[i] = h[i][i] == T() ? T() : sum / h[i][i];
+        }
+        std::vector<T> update(n, T());
+        for(size_t j = 0; j < k; ++j)
+            axpy(y[j], basis[j], update, threads);
+        m.apply(update, z, threads);
+        axpy(T(1), z, x, threads);
+
+        beta = computeResidual();  // Gerçek residual ile yeniden başla
+        result.residual = beta / bNorm;
+        if(beta == 0)
+            break;
+    }
+    result.converged = result.residual <= options.tolerance;
+    return result;
+}
+
+#endif // SPARSE_SOLVERS_H
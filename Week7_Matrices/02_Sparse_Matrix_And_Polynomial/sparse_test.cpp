@@ -1,6 +1,18 @@
 #include "sparse_matrix.h"
+#include "compressed_sparse.h"
+#include "sparse_builder.h"
+#include "blocked_sparse.h"
+#include "sparse_io.h"
+#include "sparse_solvers.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <map>
+#include <random>
 #include <cassert>
 #include <iostream>
+#include <vector>
 
 void testSparseMatrix() {
     std::cout << "\nSparse Matrix Testleri..." << std::endl;
@@ -31,6 +43,418 @@ void testSparseMatrix() {
     sm.display();
 }
 
+// Test için küçük, tekrar içeren bir COO matrix
+SparseMatrix<int> makeTestMatrix() {
+    SparseMatrix<int> sm(4, 5);
+    sm.addElement(2, 4, 7);
+    sm.addElement(0, 3, 2);
+    sm.addElement(0, 0, 1);
+    sm.addElement(3, 1, -4);
+    sm.addElement(2, 1, 3);
+    sm.addElement(0, 3, 9);  // Tekrar: get() ilk değeri (2) döndürür
+    return sm;
+}
+
+void testCompressedFormats() {
+    std::cout << "\nCSR/CSC Testleri..." << std::endl;
+    SparseMatrix<int> coo = makeTestMatrix();
+    CSRMatrix<int> csr = CSRMatrix<int>::fromCOO(coo);
+    CSCMatrix<int> csc = CSCMatrix<int>::fromCOO(coo);
+    
+    assert(csr.getNonZeroCount() == 5);
+    assert(csc.getNonZeroCount() == 5);
+    for(size_t i = 0; i < coo.getRows(); ++i)
+        for(size_t j = 0; j < coo.getCols(); ++j) {
+            assert(csr.get(i, j) == coo.get(i, j));
+            assert(csc.get(i, j) == coo.get(i, j));
+        }
+    
+    // Satır içinde sütunlar sıralı
+    const auto& ptr = csr.getRowPointers();
+    const auto& idx = csr.getColumnIndices();
+    for(size_t i = 0; i < csr.getRows(); ++i)
+        for(size_t p = ptr[i] + 1; p < ptr[i + 1]; ++p)
+            assert(idx[p - 1] < idx[p]);
+    
+    // SpMV: CSR, paralel CSR ve CSC aynı sonucu verir
+    std::vector<int> x = {1, 2, 3, 4, 5};
+    std::vector<int> expected = {1 + 2 * 4, 0, 3 * 2 + 7 * 5, -4 * 2};
+    assert(csr.multiply(x) == expected);
+    assert(csr.multiplyParallel(x, 3) == expected);
+    assert(csc.multiply(x) == expected);
+    
+    // Transpoz
+    std::vector<int> xt = {1, -1, 2, 3};
+    CSRMatrix<int> t = csr.transpose();
+    assert(t.getRows() == 5 && t.getCols() == 4);
+    assert(t.get(3, 0) == 2 && t.get(1, 3) == -4);
+    assert(t.multiply(xt) == csr.multiplyTransposed(xt));
+    assert(csc.multiplyTransposed(xt) == csr.multiplyTransposed(xt));
+    assert(csc.multiplyTransposed(xt, 2) == csr.multiplyTransposed(xt));
+    assert(csc.transpose().get(4, 2) == 7);
+    
+    // Formatlar arası dönüşüm
+    CSRMatrix<int> back = csr.toCSC().toCSR();
+    assert(back.getValues() == csr.getValues());
+    assert(back.getColumnIndices() == csr.getColumnIndices());
+    assert(csr.toCOO().getNonZeroCount() == 5);
+    
+    std::cout << "CSR/CSC dönüşümleri ve SpMV doğrulandı" << std::endl;
+}
+
+// Dense referans çarpım
+std::vector<std::vector<int>> denseOf(const CSRMatrix<int>& m) {
+    std::vector<std::vector<int>> d(m.getRows(), std::vector<int>(m.getCols(), 0));
+    for(size_t i = 0; i < m.getRows(); ++i)
+        for(size_t j = 0; j < m.getCols(); ++j)
+            d[i][j] = m.get(i, j);
+    return d;
+}
+
+void testSparseArithmetic() {
+    std::cout << "\nSparse Aritmetik Testleri..." << std::endl;
+    CSRMatrix<int> a = CSRMatrix<int>::fromCOO(makeTestMatrix());  // 4 x 5
+    
+    // Toplama: sıralı merge, sıfırlanan elementler düşer
+    SparseMatrix<int> negCoo(4, 5);
+    negCoo.addElement(0, 0, -1);
+    negCoo.addElement(1, 2, 6);
+    negCoo.addElement(2, 4, 1);
+    CSRMatrix<int> sum = a.add(CSRMatrix<int>::fromCOO(negCoo));
+    assert(sum.get(0, 0) == 0);
+    assert(sum.get(1, 2) == 6);
+    assert(sum.get(2, 4) == 8);
+    assert(sum.getNonZeroCount() == a.getNonZeroCount());  // (0,0) düştü, (1,2) eklendi
+    
+    // Çarpım: Gustavson (dense / hash akümülatör, seri / paralel) dense referans ile aynı
+    CSRMatrix<int> at = a.transpose();  // 5 x 4
+    auto da = denseOf(a), dat = denseOf(at);
+    std::vector<std::vector<int>> expected(4, std::vector<int>(4, 0));
+    for(size_t i = 0; i < 4; ++i)
+        for(size_t j = 0; j < 4; ++j)
+            for(size_t k = 0; k < 5; ++k)
+                expected[i][j] += da[i][k] * dat[k][j];
+    
+    CSRMatrix<int> products[] = {
+        a.multiply(at, SpGEMMAccumulator::Dense),
+        a.multiply(at, SpGEMMAccumulator::Hash),
+        a.multiplyParallel(at, 3, SpGEMMAccumulator::Dense),
+        a.multiplyParallel(at, 2, SpGEMMAccumulator::Hash)};
+    for(const auto& c : products) {
+        assert(denseOf(c) == expected);
+        const auto& ptr = c.getRowPointers();
+        const auto& idx = c.getColumnIndices();
+        for(size_t i = 0; i < c.getRows(); ++i)
+            for(size_t p = ptr[i] + 1; p < ptr[i + 1]; ++p)
+                assert(idx[p - 1] < idx[p]);
+    }
+    
+    // COO seviyesinde operatörler ve fast transpose
+    SparseMatrix<int> coo = makeTestMatrix();
+    SparseMatrix<int> cooSum = coo + negCoo;
+    assert(cooSum.get(2, 4) == 8 && cooSum.get(0, 0) == 0);
+    SparseMatrix<int> cooT = coo.transpose();
+    assert(cooT.getRows() == 5 && cooT.getCols() == 4);
+    assert(cooT.get(4, 2) == 7 && cooT.get(3, 0) == 2);
+    const auto& te = cooT.getElements();
+    for(size_t p = 1; p < te.size(); ++p)
+        assert(!(te[p] < te[p - 1]));
+    SparseMatrix<int> cooProd = coo * cooT;
+    assert(cooProd.get(2, 2) == 3 * 3 + 7 * 7);
+    
+    std::cout << "Sparse toplama, çarpım ve transpoz doğrulandı" << std::endl;
+}
+
+void testSparseBuilder() {
+    std::cout << "\nSparse Builder Testleri..." << std::endl;
+    const size_t rows = 300, cols = 700, count = 20000;
+    std::mt19937 rng(5);
+    std::vector<size_t> ri(count), ci(count);
+    std::vector<int> vi(count);
+    std::map<std::pair<size_t, size_t>, int> sums, maxima;
+    for(size_t p = 0; p < count; ++p) {
+        ri[p] = rng() % rows;
+        ci[p] = rng() % cols;
+        vi[p] = static_cast<int>(rng() % 9) + 1;
+        auto key = std::make_pair(ri[p], ci[p]);
+        sums[key] += vi[p];
+        maxima[key] = std::max(maxima[key], vi[p]);
+    }
+    
+    for(size_t threads : {1, 4}) {
+        SparseMatrixBuilder<int> sumBuilder(rows, cols), maxBuilder(rows, cols);
+        sumBuilder.addTriplets(ri.data(), ci.data(), vi.data(), count);
+        maxBuilder.addTriplets(ri.data(), ci.data(), vi.data(), count);
+        CSRMatrix<int> summed = sumBuilder.build(std::plus<int>(), threads);
+        CSRMatrix<int> maxed = maxBuilder.build([](int a, int b) { return std::max(a, b); }, threads);
+        
+        assert(summed.getNonZeroCount() == sums.size());
+        assert(maxed.getNonZeroCount() == maxima.size());
+        for(const auto& entry : sums)
+            assert(summed.get(entry.first.first, entry.first.second) == entry.second);
+        for(const auto& entry : maxima)
+            assert(maxed.get(entry.first.first, entry.first.second) == entry.second);
+        assert(sumBuilder.getTripletCount() == 0);
+    }
+    
+    // "İlk değer" reducer'ı SparseMatrix::get semantiğini verir; sıfıra birleşen konum düşer
+    SparseMatrixBuilder<int> builder(4, 5);
+    builder.addTriplets(makeTestMatrix().getElements());
+    builder.add(3, 1, 4);  // -4 + 4 = 0
+    CSRMatrix<int> first = builder.build([](int a, int) { return a; });
+    assert(first.get(0, 3) == 2);
+    assert(first.get(3, 1) == -4);
+    
+    SparseMatrixBuilder<int> cancel(2, 2);
+    cancel.add(1, 1, 5);
+    cancel.add(1, 1, -5);
+    assert(cancel.build().getNonZeroCount() == 0);
+    
+    std::cout << "Builder sıralama ve tekrar birleştirme doğrulandı" << std::endl;
+}
+
+void testBlockedFormats() {
+    std::cout << "\nBSR/SELL Testleri..." << std::endl;
+    // Düzensiz satır uzunlukları, blok sınırına oturmayan boyutlar
+    const size_t rows = 37, cols = 29;
+    std::mt19937 rng(3);
+    SparseMatrixBuilder<int> builder(rows, cols);
+    for(size_t i = 0; i < rows; ++i)
+        for(size_t k = 0; k < i % 7; ++k)
+            builder.add(i, rng() % cols, static_cast<int>(rng() % 5) + 1);
+    CSRMatrix<int> a = builder.build();
+    std::vector<int> x(cols);
+    for(size_t j = 0; j < cols; ++j)
+        x[j] = static_cast<int>(j % 4) - 1;
+    std::vector<int> expected = a.multiply(x);
+    
+    for(size_t bs : {1, 2, 3, 4, 5, 8}) {
+        BSRMatrix<int> bsr = BSRMatrix<int>::fromCSR(a, bs, bs);
+        assert(bsr.multiply(x) == expected);
+        assert(bsr.fillRatio() >= 1.0);
+        for(size_t i = 0; i < rows; ++i)
+            for(size_t j = 0; j < cols; ++j)
+                assert(bsr.get(i, j) == a.get(i, j));
+        assert(bsr.toCSR().getColumnIndices() == a.getColumnIndices());
+    }
+    BSRMatrix<int> rect = BSRMatrix<int>::fromCSR(a, 2, 3);
+    assert(rect.multiply(x) == expected);
+    
+    for(size_t chunk : {1, 4, 8, 16}) {
+        for(size_t sigma : {1, 8, 64}) {
+            SELLMatrix<int> sell = SELLMatrix<int>::fromCSR(a, chunk, sigma);
+            assert(sell.multiply(x) == expected);
+            for(size_t i = 0; i < rows; ++i)
+                for(size_t j = 0; j < cols; ++j)
+                    assert(sell.get(i, j) == a.get(i, j));
+        }
+    }
+    // Daha büyük σ padding'i azaltır
+    assert(SELLMatrix<int>::fromCSR(a, 8, 64).fillRatio() <= SELLMatrix<int>::fromCSR(a, 8, 8).fillRatio());
+    
+    // Auto-tuner: yoğun 4x4 bloklardan oluşan matrix için BSR seçilmeli
+    SparseMatrixBuilder<double> blocky(400, 400);
+    for(size_t b = 0; b < 100; ++b)
+        for(size_t r = 0; r < 4; ++r)
+            for(size_t c = 0; c < 4; ++c) {
+                blocky.add(b * 4 + r, b * 4 + c, 1.0 + r + c);
+                if(b + 1 < 100)
+                    blocky.add(b * 4 + r, (b + 1) * 4 + c, 0.5);
+            }
+    TunedSparseMatrix<double> tuned = TunedSparseMatrix<double>::fromCSR(blocky.build());
+    assert(tuned.getChoice().format == SparseFormat::BSR);
+    assert(tuned.getChoice().blockRows == 4);
+    assert(tuned.get(5, 6) == 4.0);
+    std::cout << "Tuner seçimi: " << tuned.getChoice().describe() << std::endl;
+    
+    std::cout << "BSR/SELL SpMV ve auto-tuner doğrulandı" << std::endl;
+}
+
+void testSparseIO() {
+    std::cout << "\nMatrix Market / Binary CSR Testleri..." << std::endl;
+    const std::string mtxPath = "sparse_io_test.mtx";
+    const std::string binPath = "sparse_io_test.csrb";
+    
+    // Yaz -> oku: kayan noktalı değerler kayıpsız, çok thread'li parse tek thread ile aynı
+    SparseMatrixBuilder<double> builder(50, 40);
+    std::mt19937 rng(9);
+    for(size_t p = 0; p < 300; ++p)
+        builder.add(rng() % 50, rng() % 40, 1.0 / (1 + rng() % 1000));
+    CSRMatrix<double> a = builder.build();
+    writeMatrixMarket(a, mtxPath);
+    for(size_t threads : {1, 3}) {
+        CSRMatrix<double> back = readMatrixMarket<double>(mtxPath, threads);
+        assert(back.getRowPointers() == a.getRowPointers());
+        assert(back.getColumnIndices() == a.getColumnIndices());
+        assert(back.getValues() == a.getValues());
+    }
+    
+    // Simetrik, yorumlu, pattern ve skew-symmetric dosyalar
+    {
+        std::ofstream out(mtxPath);
+        out << "%%MatrixMarket matrix coordinate integer symmetric\n% yorum\n\n3 3 3\n"
+            << "1 1 5\n3 1 -2\n  2 3 +7\n";
+    }
+    CSRMatrix<int> sym = readMatrixMarket<int>(mtxPath);
+    assert(sym.getNonZeroCount() == 5);
+    assert(sym.get(0, 0) == 5 && sym.get(2, 0) == -2 && sym.get(0, 2) == -2);
+    assert(sym.get(1, 2) == 7 && sym.get(2, 1) == 7);
+    {
+        std::ofstream out(mtxPath);
+        out << "%%MatrixMarket matrix coordinate pattern skew-symmetric\n2 2 1\n2 1\n";
+    }
+    CSRMatrix<int> skew = readMatrixMarket<int>(mtxPath);
+    assert(skew.get(1, 0) == 1 && skew.get(0, 1) == -1);
+    
+    // Hatalı dosyalar
+    {
+        std::ofstream out(mtxPath);
+        out << "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1.0\n";
+    }
+    bool threw = false;
+    try { readMatrixMarket<double>(mtxPath); } catch(const std::runtime_error&) { threw = true; }
+    assert(threw);
+    {
+        std::ofstream out(mtxPath);
+        out << "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1.0\n";
+    }
+    threw = false;
+    try { readMatrixMarket<double>(mtxPath); } catch(const std::out_of_range&) { threw = true; }
+    assert(threw);
+    
+    // Binary CSR: kopyasız görünüm
+    writeBinaryCSR(a, binPath);
+    {
+        CSRMatrixView<double> view(binPath);
+        assert(view.getRows() == 50 && view.getCols() == 40);
+        assert(view.getNonZeroCount() == a.getNonZeroCount());
+        for(size_t i = 0; i < 50; ++i)
+            for(size_t j = 0; j < 40; ++j)
+                assert(view.get(i, j) == a.get(i, j));
+        std::vector<double> x(40, 2.0);
+        assert(view.multiply(x) == a.multiply(x));
+        assert(view.toCSR().getValues() == a.getValues());
+    }
+    threw = false;
+    try { CSRMatrixView<float> wrongType(binPath); } catch(const std::runtime_error&) { threw = true; }
+    assert(threw);
+    
+    // Bozuk dosyalar: taşan nnz başlıkta, sınır dışı sütun validate() ile yakalanır
+    auto patch = [&](long offset, uint64_t value) {
+        std::FILE* f = std::fopen(binPath.c_str(), "r+b");
+        assert(f);
+        std::fseek(f, offset, SEEK_SET);
+        std::fwrite(&value, sizeof(value), 1, f);
+        std::fclose(f);
+    };
+    CSRMatrixView<double>(binPath).validate();
+    long colOffset = static_cast<long>(sizeof(BinaryCSRHeader) + 51 * sizeof(uint64_t));
+    patch(colOffset, 40);
+    {
+        CSRMatrixView<double> corrupt(binPath);
+        threw = false;
+        try { corrupt.validate(); } catch(const std::runtime_error&) { threw = true; }
+        assert(threw);
+    }
+    patch(static_cast<long>(sizeof(BinaryCSRHeader) - sizeof(uint64_t)), UINT64_MAX / 8);  // nnz son alan
+    threw = false;
+    try { CSRMatrixView<double> wrapped(binPath); } catch(const std::runtime_error&) { threw = true; }
+    assert(threw);
+    
+    std::remove(mtxPath.c_str());
+    std::remove(binPath.c_str());
+    std::cout << "Matrix Market ve binary CSR doğrulandı" << std::endl;
+}
+
+// grid x grid 2D ızgarada 5 noktalı fark operatörü; convection > 0 simetriyi bozar
+CSRMatrix<double> gridOperator(size_t grid, double convection) {
+    SparseMatrixBuilder<double> builder(grid * grid, grid * grid);
+    for(size_t r = 0; r < grid; ++r)
+        for(size_t c = 0; c < grid; ++c) {
+            size_t i = r * grid + c;
+            builder.add(i, i, 4.0);
+            if(c > 0) builder.add(i, i - 1, -1.0 - convection);
+            if(c + 1 < grid) builder.add(i, i + 1, -1.0 + convection);
+            if(r > 0) builder.add(i, i - grid, -1.0);
+            if(r + 1 < grid) builder.add(i, i + grid, -1.0);
+        }
+    return builder.build();
+}
+
+double relativeResidual(const CSRMatrix<double>& a, const std::vector<double>& x, const std::vector<double>& b) {
+    std::vector<double> r = a.multiply(x);
+    double num = 0, den = 0;
+    for(size_t i = 0; i < b.size(); ++i) {
+        num += (r[i] - b[i]) * (r[i] - b[i]);
+        den += b[i] * b[i];
+    }
+    return std::sqrt(num / den);
+}
+
+void testIterativeSolvers() {
+    std::cout << "\nIteratif Çözücü Testleri..." << std::endl;
+    CSRMatrix<double> poisson = gridOperator(20, 0.0);
+    CSRMatrix<double> convective = gridOperator(20, 0.4);
+    std::vector<double> b(400);
+    for(size_t i = 0; i < b.size(); ++i)
+        b[i] = 1.0 + static_cast<double>(i % 7);
+    
+    // Paralel vektör çekirdekleri seri ile aynı sonucu verir
+    std::vector<double> big(100000, 0.5);
+    assert(std::abs(dot(big, big, 4) - 25000.0) < 1e-9);
+    
+    SolverOptions options;
+    options.tolerance = 1e-10;
+    options.threads = 2;
+    
+    std::vector<double> x;
+    SolverResult plain = conjugateGradient(poisson, b, x, IdentityPreconditioner<double>(), options);
+    assert(plain.converged && relativeResidual(poisson, x, b) < 1e-9);
+    x.clear();
+    SolverResult jacobi = conjugateGradient(poisson, b, x, JacobiPreconditioner<double>(poisson), options);
+    assert(jacobi.converged && relativeResidual(poisson, x, b) < 1e-9);
+    x.clear();
+    SolverResult ilu = conjugateGradient(poisson, b, x, ILU0Preconditioner<double>(poisson), options);
+    assert(ilu.converged && relativeResidual(poisson, x, b) < 1e-9);
+    assert(ilu.iterations < plain.iterations);
+    
+    x.clear();
+    SolverResult bicg = biCGSTAB(convective, b, x, ILU0Preconditioner<double>(convective), options);
+    assert(bicg.converged && relativeResidual(convective, x, b) < 1e-9);
+    
+    options.restart = 10;  // Restart'ı zorlayacak kadar küçük
+    x.clear();
+    SolverResult restarted = gmres(convective, b, x, JacobiPreconditioner<double>(convective), options);
+    assert(restarted.converged && relativeResidual(convective, x, b) < 1e-9);
+    
+    // Tridiagonal matrix'te ILU(0) tam LU'dur: tek iterasyonda çözülür
+    SparseMatrixBuilder<double> triBuilder(50, 50);
+    for(size_t i = 0; i < 50; ++i) {
+        triBuilder.add(i, i, 3.0);
+        if(i > 0) triBuilder.add(i, i - 1, -1.0);
+        if(i + 1 < 50) triBuilder.add(i, i + 1, -2.0);
+    }
+    CSRMatrix<double> tri = triBuilder.build();
+    std::vector<double> triB(50, 1.0);
+    x.clear();
+    SolverResult exact = gmres(tri, triB, x, ILU0Preconditioner<double>(tri), options);
+    assert(exact.converged && exact.iterations == 1);
+    
+    // Callback: residual'lar raporlanır, false dönünce durulur
+    std::vector<double> history;
+    options.callback = [&](size_t, double residual) {
+        history.push_back(residual);
+        return history.size() < 3;
+    };
+    x.clear();
+    SolverResult stopped = conjugateGradient(poisson, b, x, IdentityPreconditioner<double>(), options);
+    assert(!stopped.converged && stopped.iterations == 3 && history.size() == 3);
+    
+    std::cout << "CG iterasyon: plain " << plain.iterations << ", Jacobi " << jacobi.iterations
+              << ", ILU(0) " << ilu.iterations << "; BiCGSTAB " << bicg.iterations
+              << ", GMRES(10) " << restarted.iterations << std::endl;
+}
+
 void testPolynomial() {
     std::cout << "\nPolynomial Testleri..." << std::endl;
     
@@ -84,10 +508,281 @@ void testPolynomial() {
     assert(product.getCoefficient(0) == 0);
 }
 
+// 400 katsayılı rastgele yoğun polinom
+std::vector<long long> randomCoefficients(std::mt19937_64& rng) {
+    std::vector<long long> c(400);
+    for(auto& x : c) x = static_cast<long long>(rng() % 201) - 100;
+    c.back() = 7;
+    return c;
+}
+
+void testPolynomialMultiply() {
+    std::cout << "\nPolynomial Hızlı Çarpım Testleri..." << std::endl;
+    std::mt19937_64 rng(17);
+    
+    // Tamsayı: Karatsuba ve NTT schoolbook ile bit bit aynı (negatif katsayılar dahil)
+    for(size_t n : {1, 31, 33, 200, 1000}) {
+        std::vector<long long> a(n), b(n / 2 + 7);
+        for(auto& c : a) c = static_cast<long long>(rng() % 2000001) - 1000000;
+        for(auto& c : b) c = static_cast<long long>(rng() % 2000001) - 1000000;
+        std::vector<long long> expected = multiplySchoolbook(a, b);
+        assert(multiplyKaratsuba(a, b) == expected);
+        assert(multiplyNTT(a, b) == expected);
+        assert(multiplyDense(a, b) == expected);
+    }
+    // Büyük katsayılar: NTT sınırı aşılır, sonuç yine schoolbook ile aynı (Karatsuba'ya düşülür);
+    // işaretsiz tipte taşma mod 2^64 tanımlıdır
+    std::vector<unsigned long long> huge(300, 3000000000000ULL);
+    assert(multiplyNTT(huge, huge) == multiplySchoolbook(huge, huge));
+    // İşaretsiz, CRT aralığını aşan girdiler: ~2^36 * 2^37 * 8192 = 2^86 (Karatsuba'ya düşer)
+    std::vector<uint64_t> ua(8192, uint64_t(1) << 36), ub(8192);
+    for(auto& c : ub) c = (uint64_t(1) << 37) - 1 - rng() % 1000;
+    std::vector<uint64_t> schoolbookWide = multiplySchoolbook(ua, ub);
+    assert(multiplyDense(ua, ub) == schoolbookWide);
+    assert((Polynomial<uint64_t>::fromCoefficients(ua) * Polynomial<uint64_t>::fromCoefficients(ub)).toDense() == schoolbookWide);
+    // Sınır içinde ama 2^64'ü aşan katsayılar: NTT yolu, sonuç mod 2^64
+    std::vector<uint64_t> uc(4096), ud(4096);
+    for(auto& c : uc) c = rng() % (uint64_t(1) << 30);
+    for(auto& c : ud) c = rng() % (uint64_t(1) << 30) + (uint64_t(1) << 29);
+    assert(multiplyNTT(uc, ud) == multiplySchoolbook(uc, ud));
+    
+    // Kayan nokta: FFT yuvarlama hatası içinde
+    std::vector<double> fa(700), fb(500);
+    for(auto& c : fa) c = static_cast<double>(rng() % 1000) / 100.0 - 5.0;
+    for(auto& c : fb) c = static_cast<double>(rng() % 1000) / 100.0 - 5.0;
+    std::vector<double> exact = multiplySchoolbook(fa, fb), viaFFT = multiplyFFT(fa, fb);
+    for(size_t k = 0; k < exact.size(); ++k)
+        assert(std::abs(exact[k] - viaFFT[k]) < 1e-6);
+    
+    // Otomatik dense/sparse geçişi
+    Polynomial<long long> sparse;
+    sparse.addTerm(1000, 2);
+    sparse.addTerm(0, 1);
+    assert(sparse.getStorage() == PolynomialStorage::Sparse);
+    Polynomial<long long> dense = Polynomial<long long>::fromCoefficients(randomCoefficients(rng));
+    assert(dense.getStorage() == PolynomialStorage::Dense);
+    dense.addTerm(100000, 1);  // Derece sıçraması -> sparse
+    assert(dense.getStorage() == PolynomialStorage::Sparse && dense.getDegree() == 100000);
+    dense.addTerm(100000, 0);  // Terimi silmek dereceyi düşürür -> tekrar dense
+    assert(dense.getStorage() == PolynomialStorage::Dense && dense.getDegree() == 399);
+    
+    // Toplamda sıfırlanan terimler düşer
+    Polynomial<long long> p, q;
+    p.addTerm(3, 5);
+    p.addTerm(0, 1);
+    q.addTerm(3, -5);
+    Polynomial<long long> cancel = p + q;
+    assert(cancel.getDegree() == 0 && cancel.getCoefficient(3) == 0 && cancel.getTermCount() == 1);
+    
+    // Dense x dense (Karatsuba yolu), sparse x dense ve sparse x sparse aynı sonucu verir
+    Polynomial<long long> product = dense * dense;
+    assert(product.toDense() == multiplySchoolbook(dense.toDense(), dense.toDense()));
+    Polynomial<long long> mixed = sparse * dense;
+    std::vector<long long> mixedExpected = multiplySchoolbook(sparse.toDense(), dense.toDense());
+    assert(mixed.toDense() == mixedExpected);
+    Polynomial<long long> sq = sparse * sparse;
+    assert(sq.getCoefficient(2000) == 4 && sq.getCoefficient(1000) == 4 && sq.getCoefficient(0) == 1);
+    assert(sq.getTermCount() == 3 && sq.getStorage() == PolynomialStorage::Sparse);
+    
+    // Heap merge: çakışan ve birbirini götüren üsler, map ile toplanmış referansla aynı sıralı sonuç
+    for(size_t trial = 0; trial < 20; ++trial) {
+        std::map<size_t, long long> ta, tb, expectedTerms;
+        for(size_t k = 0; k < 1 + trial * 7; ++k) ta[rng() % 500] = static_cast<long long>(rng() % 7) - 3;
+        for(size_t k = 0; k < 1 + trial * 3; ++k) tb[(rng() % 50) * 10] = static_cast<long long>(rng() % 7) - 3;
+        std::vector<std::pair<size_t, long long>> va, vb;
+        for(const auto& t : ta) if(t.second != 0) va.push_back(t);
+        for(const auto& t : tb) if(t.second != 0) vb.push_back(t);
+        for(const auto& x : va)
+            for(const auto& y : vb)
+                expectedTerms[x.first + y.first] += x.second * y.second;
+        std::vector<std::pair<size_t, long long>> expectedVector;
+        for(const auto& t : expectedTerms) if(t.second != 0) expectedVector.push_back(t);
+        assert(multiplySparseTerms(va, vb) == expectedVector);
+        assert(multiplySparseTerms(vb, va) == expectedVector);
+    }
+    // Çok seyrek, yüksek dereceli polinomlar heap yolunda kalır
+    Polynomial<long long> wide;
+    for(size_t k = 0; k < 50; ++k) wide.addTerm(k * 100000, static_cast<long long>(k) + 1);
+    Polynomial<long long> wideSquare = wide * wide;
+    assert(wideSquare.getStorage() == PolynomialStorage::Sparse && wideSquare.getDegree() == 9800000);
+    assert(wideSquare.getTermCount() == 99 && wideSquare.getCoefficient(100000) == 4);
+    
+    std::cout << "Schoolbook / Karatsuba / NTT / FFT / heap merge ve biçim geçişleri doğrulandı" << std::endl;
+}
+
+void testPolynomialEvaluate() {
+    std::cout << "\nPolynomial Değerlendirme Testleri..." << std::endl;
+    // 3x^2 + 2x + 1
+    Polynomial<int> small;
+    small.addTerm(2, 3);
+    small.addTerm(1, 2);
+    small.addTerm(0, 1);
+    assert(small.evaluate(2) == 17);
+    assert(small.evaluateEstrin(-3) == 22);
+    assert(Polynomial<int>().evaluate(5) == 0);
+    
+    // Sparse: x^40 + 2x^3 (üs farkları kare alma ile)
+    Polynomial<long long> sparse;
+    sparse.addTerm(40, 1);
+    sparse.addTerm(3, 2);
+    assert(sparse.getStorage() == PolynomialStorage::Sparse);
+    assert(sparse.evaluate(2) == (1LL << 40) + 16);
+    assert(sparse.evaluate(std::vector<long long>{1, 2}) == (std::vector<long long>{3, (1LL << 40) + 16}));
+    
+    // Derece 20, kayan nokta: Horner, Estrin ve batch aynı sonucu verir
+    std::mt19937_64 rng(23);
+    std::vector<double> coeffs(21);
+    for(auto& c : coeffs) c = static_cast<double>(rng() % 200) / 100.0 - 1.0;
+    Polynomial<double> curve = Polynomial<double>::fromCoefficients(coeffs);
+    std::vector<double> xs(1000);
+    for(auto& x : xs) x = static_cast<double>(rng() % 2000) / 1000.0 - 1.0;
+    std::vector<double> batch = curve.evaluate(xs);
+    for(size_t j = 0; j < xs.size(); ++j) {
+        double horner = curve.evaluate(xs[j]);
+        assert(std::abs(batch[j] - horner) < 1e-12);
+        assert(std::abs(curve.evaluateEstrin(xs[j]) - horner) < 1e-12);
+    }
+    
+    // Subproduct tree: Z/2^64 halkasında Horner ile bit bit aynı
+    std::vector<unsigned long long> big(3000), points(5000);
+    for(auto& c : big) c = rng();
+    for(auto& x : points) x = rng();
+    Polynomial<unsigned long long> ring = Polynomial<unsigned long long>::fromCoefficients(big);
+    std::vector<unsigned long long> viaTree(points.size());
+    evaluateMultipoint(big, points.data(), points.size(), viaTree.data());
+    std::vector<unsigned long long> viaPolynomial = ring.evaluate(points);  // Eşiğin altında: batch Horner
+    for(size_t j = 0; j < points.size(); ++j) {
+        unsigned long long horner = hornerEvaluate(big.data(), big.size(), points[j]);
+        assert(viaTree[j] == horner);
+        assert(viaPolynomial[j] == horner);
+    }
+    
+    // İşaretli tamsayı, eşik üstü derece: ağaç işaretsiz tipte kurulur (taşma UB olmaz), sonuç Horner ile aynı
+    std::vector<long long> signedCoeffs(MULTIPOINT_THRESHOLD + 1);
+    for(auto& c : signedCoeffs) c = static_cast<long long>(rng() % 3) - 1;
+    signedCoeffs.back() = 1;
+    std::vector<long long> unitPoints(MULTIPOINT_THRESHOLD + 100);
+    for(auto& x : unitPoints) x = static_cast<long long>(rng() % 3) - 1;
+    std::vector<long long> signedValues = Polynomial<long long>::fromCoefficients(signedCoeffs).evaluate(unitPoints);
+    for(size_t j = 0; j < unitPoints.size(); j += 97)
+        assert(signedValues[j] == hornerEvaluate(signedCoeffs.data(), signedCoeffs.size(), unitPoints[j]));
+    
+    std::cout << "Horner / Estrin / batch / subproduct tree doğrulandı" << std::endl;
+}
+
+template<typename T>
+std::vector<T> randomModCoefficients(std::mt19937_64& rng, size_t n) {
+    std::vector<T> c(n);
+    for(auto& x : c) x = T(static_cast<long long>(rng() % T::modulus()));
+    c.back() = T(static_cast<long long>(rng() % (T::modulus() - 1)) + 1);  // Baş katsayı sıfır değil
+    return c;
+}
+
+// a == b q + r ve deg r < deg b
+template<typename T>
+bool checkDivision(const Polynomial<T>& a, const Polynomial<T>& b, const Polynomial<T>& q, const Polynomial<T>& r) {
+    return b * q + r == a && (r.isZero() || r.getDegree() < b.getDegree());
+}
+
+void testPolynomialDivision() {
+    std::cout << "\nPolynomial Bölme / GCD / Z/p Testleri..." << std::endl;
+    using Mod7 = ModInt<7>;
+    using NttMod = ModInt<998244353>;
+    using BigMod = ModInt<1000000007>;  // NTT dostu değil: üç asal + CRT
+    
+    assert(Mod7(3) * Mod7(5) == Mod7(1));
+    assert(Mod7(-1) == Mod7(6) && Mod7(2) / Mod7(4) == Mod7(4));
+    assert(Mod7(3).inverse() == Mod7(5));
+    bool threw = false;
+    try { Mod7(0).inverse(); } catch(const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    
+    // ModInt NTT çarpımı schoolbook ile aynı
+    std::mt19937_64 rng(29);
+    std::vector<NttMod> na = randomModCoefficients<NttMod>(rng, 700), nb = randomModCoefficients<NttMod>(rng, 500);
+    assert(multiplyModular(na, nb) == multiplySchoolbook(na, nb));
+    std::vector<BigMod> ba = randomModCoefficients<BigMod>(rng, 700), bb = randomModCoefficients<BigMod>(rng, 500);
+    assert(multiplyModular(ba, bb) == multiplySchoolbook(ba, bb));
+    
+    // (x^3 - 1) / (x - 1) = x^2 + x + 1, kalan 0
+    Polynomial<double> cube = Polynomial<double>::fromCoefficients({-1, 0, 0, 1});
+    Polynomial<double> linear = Polynomial<double>::fromCoefficients({-1, 1});
+    auto division = cube.divide(linear);
+    assert(division.first == Polynomial<double>::fromCoefficients({1, 1, 1}));
+    assert(division.second.isZero());
+    assert((cube % Polynomial<double>::fromCoefficients({0, 2})) == Polynomial<double>::fromCoefficients({-1}));
+    
+    // Büyük derece, monik olmayan bölen: long division ve Newton yolları
+    for(size_t divisorSize : {20, 1000}) {
+        Polynomial<NttMod> a = Polynomial<NttMod>::fromCoefficients(randomModCoefficients<NttMod>(rng, 3000));
+        Polynomial<NttMod> b = Polynomial<NttMod>::fromCoefficients(randomModCoefficients<NttMod>(rng, divisorSize));
+        auto qr = a.divide(b);
+        assert(checkDivision(a, b, qr.first, qr.second));
+        Polynomial<BigMod> c = Polynomial<BigMod>::fromCoefficients(randomModCoefficients<BigMod>(rng, 3000));
+        Polynomial<BigMod> d = Polynomial<BigMod>::fromCoefficients(randomModCoefficients<BigMod>(rng, divisorSize));
+        assert(checkDivision(c, d, c / d, c % d));
+    }
+    
+    // Tamsayılar: monik bölen tam, terslenemeyen baş katsayı istisna.
+    // Bölünen q * b + r olarak kurulur; böylece bölüm ve ara kalanlar küçük kalır (rastgele bölünende taşar)
+    std::vector<long long> monic = randomCoefficients(rng);
+    monic.back() = 1;
+    Polynomial<long long> ib = Polynomial<long long>::fromCoefficients(monic);
+    Polynomial<long long> iq = Polynomial<long long>::fromCoefficients(randomCoefficients(rng));
+    std::vector<long long> remainder = randomCoefficients(rng);
+    remainder.resize(monic.size() - 1);
+    Polynomial<long long> ir = Polynomial<long long>::fromCoefficients(remainder);
+    Polynomial<long long> ia = iq * ib + ir;
+    assert(ia / ib == iq && ia % ib == ir);
+    assert(checkDivision(ia, ib, ia / ib, ia % ib));
+    threw = false;
+    try { ia / Polynomial<long long>::fromCoefficients({1, 2}); } catch(const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { ia % Polynomial<long long>(); } catch(const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    
+    // GCD: ortak monik çarpan geri bulunur
+    std::vector<NttMod> common = randomModCoefficients<NttMod>(rng, 60);
+    common.back() = NttMod(1);
+    Polynomial<NttMod> g = Polynomial<NttMod>::fromCoefficients(common);
+    Polynomial<NttMod> u = Polynomial<NttMod>::fromCoefficients(randomModCoefficients<NttMod>(rng, 300));
+    Polynomial<NttMod> v = Polynomial<NttMod>::fromCoefficients(randomModCoefficients<NttMod>(rng, 200));
+    assert(Polynomial<NttMod>::gcd(g * u, g * v) == g);
+    // Kayan nokta: (x-1)(x-2) ve (x-1)(x+3) -> x - 1
+    Polynomial<double> fg = Polynomial<double>::gcd(Polynomial<double>::fromCoefficients({2, -3, 1}),
+                                                    Polynomial<double>::fromCoefficients({-3, 2, 1}));
+    assert(fg.getDegree() == 1 && std::abs(fg.getCoefficient(0) + 1) < 1e-9 && fg.getCoefficient(1) == 1);
+    
+    // powMod: tekrarlı kare alma, tekrarlı çarpıp kalan alma ile aynı
+    Polynomial<NttMod> f = Polynomial<NttMod>::fromCoefficients(randomModCoefficients<NttMod>(rng, 701));  // Kalan çarpımları Newton ile indirgenir
+    Polynomial<NttMod> base = Polynomial<NttMod>::fromCoefficients(randomModCoefficients<NttMod>(rng, 900));
+    Polynomial<NttMod> expected = Polynomial<NttMod>::fromCoefficients({NttMod(1)});
+    for(int k = 0; k < 37; ++k)
+        expected = expected * base % f;
+    assert(base.powMod(37, f) == expected);
+    // Z/7'de x^2 + 1 indirgenemez (7 = 3 mod 4), bölüm halkası F_49: x^49 = x
+    Polynomial<Mod7> x = Polynomial<Mod7>::fromCoefficients({Mod7(0), Mod7(1)});
+    Polynomial<Mod7> irreducible = Polynomial<Mod7>::fromCoefficients({Mod7(1), Mod7(0), Mod7(1)});
+    assert(x.powMod(49, irreducible) == x);
+    assert(x.powMod(7, irreducible) != x);
+    
+    std::cout << "Long division / Newton bölme / GCD / powMod / Z/p doğrulandı" << std::endl;
+}
+
 int main() {
     try {
         testSparseMatrix();
+        testCompressedFormats();
+        testSparseArithmetic();
+        testSparseBuilder();
+        testBlockedFormats();
+        testSparseIO();
+        testIterativeSolvers();
         testPolynomial();
+        testPolynomialMultiply();
+        testPolynomialEvaluate();
+        testPolynomialDivision();
         
         std::cout << "\nTüm testler başarıyla tamamlandı!" << std::endl;
         return 0;
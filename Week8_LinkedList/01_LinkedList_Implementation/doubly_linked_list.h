@@ -0,0 +1,471 @@
+#ifndef DOUBLY_LINKED_LIST_H
+#define DOUBLY_LINKED_LIST_H
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "node_pool.h"
+
+// Çift yönlü bağlı liste - LinkedList ile aynı API, ek olarak O(1) popBack,
+// iterator ile O(1) ekleme/silme ve STL uyumlu bidirectional iterator'lar.
+// Düğüm başına bir pointer fazladan bellek (bkz. linked_list_benchmark "bellek" bölümü).
+// Liste dairesel ve sentinel'lidir: sentinel.next ilk, sentinel.prev son düğüm; end() sentinel'dir.
+template <typename T, typename NodeAllocator = HeapNodeAllocator>
+class DoublyLinkedList {
+private:
+    // Bağlantılar ayrı taban yapıda: sentinel veri taşımaz
+    struct Links {
+        Links* prev;
+        Links* next;
+    };
+
+    struct Node : Links {
+        T data;
+        Node(const T& value) : Links{nullptr, nullptr}, data(value) {}
+    };
+
+    using Allocator = typename NodeAllocator::template Pool<Node>;
+
+    Links sentinel;
+    size_t size;
+    Allocator allocator;
+
+    static Node* asNode(Links* links) { return static_cast<Node*>(links); }
+    static const Node* asNode(const Links* links) { return static_cast<const Node*>(links); }
+
+    Node* createNode(const T& value) {
+        void* memory = allocator.allocate();
+        try {
+            return new (memory) Node(value);
+        } catch (...) {
+            allocator.deallocate(memory);
+            throw;
+        }
+    }
+
+    void destroyNode(Node* node) {
+        node->~Node();
+        allocator.deallocate(node);
+    }
+
+    // node'u position'ın önüne bağlar
+    static void link(Links* position, Links* node) {
+        node->prev = position->prev;
+        node->next = position;
+        position->prev->next = node;
+        position->prev = node;
+    }
+
+    static void unlink(Links* node) {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    // index < size; yakın uçtan yürünür, en fazla n / 2 adım
+    Links* getLinks(size_t index) const {
+        Links* current;
+        if (index < size / 2) {
+            current = sentinel.next;
+            for (size_t i = 0; i < index; i++) current = current->next;
+        } else {
+            current = sentinel.prev;
+            for (size_t i = size - 1; i > index; i--) current = current->prev;
+        }
+        return current;
+    }
+
+    // Sıralama: prev bağlantıları yok sayılarak next zinciri LinkedList'teki gibi birleştirilir,
+    // sonunda tek geçişte prev'ler yeniden kurulur
+    struct Run {
+        Links* first;
+        Links* last;
+    };
+
+    static Run merge(Run left, Run right) {
+        if (left.first == nullptr) return right;
+        if (right.first == nullptr) return left;
+        Links* a = left.first;
+        Links* b = right.first;
+        Links* result = nullptr;
+        Links** cursor = &result;
+        while (a != nullptr && b != nullptr) {
+            if (asNode(a)->data <= asNode(b)->data) {
+                *cursor = a;
+                cursor = &a->next;
+                a = a->next;
+            } else {
+                *cursor = b;
+                cursor = &b->next;
+                b = b->next;
+            }
+        }
+        *cursor = (a != nullptr) ? a : b;
+        return {result, (a != nullptr) ? left.last : right.last};
+    }
+
+public:
+    template <bool Const>
+    class Iterator {
+    private:
+        using LinksPtr = typename std::conditional<Const, const Links*, Links*>::type;
+        LinksPtr links;
+        friend class DoublyLinkedList;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        Iterator() : links(nullptr) {}
+        explicit Iterator(LinksPtr l) : links(l) {}
+        // iterator -> const_iterator dönüşümü
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        Iterator(const Iterator<OtherConst>& other) : links(other.links) {}
+
+        reference operator*() const { return asNode(links)->data; }
+        pointer operator->() const { return &asNode(links)->data; }
+        Iterator& operator++() {
+            links = links->next;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            links = links->next;
+            return previous;
+        }
+        Iterator& operator--() {
+            links = links->prev;
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator previous = *this;
+            links = links->prev;
+            return previous;
+        }
+        bool operator==(const Iterator& other) const { return links == other.links; }
+        bool operator!=(const Iterator& other) const { return links != other.links; }
+
+        template <bool>
+        friend class Iterator;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // Düğüm başına bellek (allocator ek yükü hariç)
+    static constexpr size_t NODE_BYTES = sizeof(Node);
+
+    // Yapıcı fonksiyon
+    DoublyLinkedList() : sentinel{&sentinel, &sentinel}, size(0) {}
+
+    // Kopyalama yapıcı fonksiyonu
+    DoublyLinkedList(const DoublyLinkedList& other) : sentinel{&sentinel, &sentinel}, size(0) {
+        concat(other);
+    }
+
+    DoublyLinkedList& operator=(const DoublyLinkedList& other) {
+        if (this != &other) {
+            clear();
+            concat(other);
+        }
+        return *this;
+    }
+
+    // Yıkıcı fonksiyon
+    ~DoublyLinkedList() {
+        clear();
+    }
+
+    // Iterator'lar
+    iterator begin() { return iterator(sentinel.next); }
+    iterator end() { return iterator(&sentinel); }
+    const_iterator begin() const { return const_iterator(sentinel.next); }
+    const_iterator end() const { return const_iterator(&sentinel); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    // Temel operasyonlar
+    bool empty() const {
+        return size == 0;
+    }
+
+    size_t getSize() const {
+        return size;
+    }
+
+    // position'ın önüne ekler, yeni elemanı gösteren iterator döner - O(1)
+    iterator insert(const_iterator position, const T& value) {
+        Node* node = createNode(value);
+        link(const_cast<Links*>(position.links), node);
+        size++;
+        return iterator(node);
+    }
+
+    // position'daki elemanı siler, sonrakini gösteren iterator döner - O(1)
+    iterator erase(const_iterator position) {
+        if (position == end()) {
+            throw std::out_of_range("Iterator out of range");
+        }
+        Links* links = const_cast<Links*>(position.links);
+        Links* next = links->next;
+        unlink(links);
+        destroyNode(asNode(links));
+        size--;
+        return iterator(next);
+    }
+
+    void pushFront(const T& value) {
+        insert(begin(), value);
+    }
+
+    void pushBack(const T& value) {
+        insert(end(), value);
+    }
+
+    void insert(size_t index, const T& value) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        Links* position = (index == size) ? &sentinel : getLinks(index);
+        insert(const_iterator(position), value);
+    }
+
+    void popFront() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        erase(begin());
+    }
+
+    // O(1): son düğümün öncesi prev bağlantısından bilinir
+    void popBack() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        erase(const_iterator(sentinel.prev));
+    }
+
+    void remove(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        erase(const_iterator(getLinks(index)));
+    }
+
+    void removeValue(const T& value) {
+        for (iterator it = begin(); it != end(); ++it) {
+            if (*it == value) {
+                erase(it);
+                return;
+            }
+        }
+    }
+
+    // Erişim operasyonları
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return asNode(sentinel.next)->data;
+    }
+
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return asNode(sentinel.next)->data;
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return asNode(sentinel.prev)->data;
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return asNode(sentinel.prev)->data;
+    }
+
+    T& at(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return asNode(getLinks(index))->data;
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return asNode(getLinks(index))->data;
+    }
+
+    // Arama operasyonları
+    size_t find(const T& value) const {
+        size_t index = 0;
+        for (const T& item : *this) {
+            if (item == value) {
+                return index;
+            }
+            index++;
+        }
+        return size;
+    }
+
+    bool contains(const T& value) const {
+        return find(value) != size;
+    }
+
+    // İstatistiksel operasyonlar
+    T getMax() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T maxVal = front();
+        for (const T& item : *this) {
+            if (item > maxVal) {
+                maxVal = item;
+            }
+        }
+        return maxVal;
+    }
+
+    T getMin() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T minVal = front();
+        for (const T& item : *this) {
+            if (item < minVal) {
+                minVal = item;
+            }
+        }
+        return minVal;
+    }
+
+    T getSum() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T sum = T();
+        for (const T& item : *this) {
+            sum += item;
+        }
+        return sum;
+    }
+
+    double getAverage() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return static_cast<double>(getSum()) / size;
+    }
+
+    // Manipülasyon operasyonları - her düğümde (sentinel dahil) prev ve next yer değiştirir
+    void reverse() {
+        Links* current = &sentinel;
+        do {
+            std::swap(current->prev, current->next);
+            current = current->prev;  // Takastan önceki next
+        } while (current != &sentinel);
+    }
+
+    // LinkedList::sort ile aynı bin tabanlı iteratif merge sort; kararlı, ek bellek yok
+    void sort() {
+        if (size <= 1) return;
+        sentinel.prev->next = nullptr;
+        Links* remaining = sentinel.next;
+        Run bins[64] = {};
+        while (remaining != nullptr) {
+            Run carry = {remaining, remaining};
+            remaining = remaining->next;
+            carry.last->next = nullptr;
+            size_t i = 0;
+            for (; bins[i].first != nullptr; i++) {
+                carry = merge(bins[i], carry);
+                bins[i] = Run{nullptr, nullptr};
+            }
+            bins[i] = carry;
+        }
+        Run result = {nullptr, nullptr};
+        for (const Run& bin : bins) {
+            result = merge(bin, result);
+        }
+        // prev bağlantılarını ve dairesel yapıyı yeniden kur
+        Links* previous = &sentinel;
+        for (Links* current = result.first; current != nullptr; current = current->next) {
+            current->prev = previous;
+            previous->next = current;
+            previous = current;
+        }
+        previous->next = &sentinel;
+        sentinel.prev = previous;
+    }
+
+    void clear() {
+        if (Allocator::bulkClear) {
+            if (!std::is_trivially_destructible<T>::value) {
+                Links* current = sentinel.next;
+                while (current != &sentinel) {
+                    Links* next = current->next;  // Yıkıcıdan sonra düğüm okunmaz
+                    asNode(current)->~Node();
+                    current = next;
+                }
+            }
+            allocator.reset();
+        } else {
+            Links* current = sentinel.next;
+            while (current != &sentinel) {
+                Links* next = current->next;
+                destroyNode(asNode(current));
+                current = next;
+            }
+        }
+        sentinel.prev = sentinel.next = &sentinel;
+        size = 0;
+    }
+
+    // Birleştirme operasyonları
+    void concat(const DoublyLinkedList& other) {
+        for (const T& item : other) {
+            pushBack(item);
+        }
+    }
+
+    DoublyLinkedList merge(const DoublyLinkedList& other) const {
+        DoublyLinkedList result;
+        const_iterator p1 = begin(), p2 = other.begin();
+        while (p1 != end() && p2 != other.end()) {
+            if (*p1 <= *p2) {
+                result.pushBack(*p1++);
+            } else {
+                result.pushBack(*p2++);
+            }
+        }
+        for (; p1 != end(); ++p1) result.pushBack(*p1);
+        for (; p2 != other.end(); ++p2) result.pushBack(*p2);
+        return result;
+    }
+
+    // Ortadaki eleman (LinkedList::findMiddle ile aynı konum); boş listede end()
+    const_iterator findMiddle() const {
+        if (empty()) return end();
+        return const_iterator(getLinks(size / 2));
+    }
+};
+
+#endif // DOUBLY_LINKED_LIST_H
@@ -1,12 +1,20 @@
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 #include <string>
-
-// Genel amaçlı bağlı liste sınıfı
-template <typename T>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "node_pool.h"
+
+// Genel amaçlı bağlı liste sınıfı.
+// NodeAllocator düğüm belleğinin nereden geleceğini belirler (bkz. node_pool.h):
+// HeapNodeAllocator (varsayılan), PoolNodeAllocator (listeye özel slab), SharedPoolNodeAllocator (thread_local).
+template <typename T, typename NodeAllocator = HeapNodeAllocator>
 class LinkedList {
 private:
     // Düğüm yapısı
@@ -16,9 +24,27 @@ private:
         Node(const T& value) : data(value), next(nullptr) {}
     };
 
+    using Allocator = typename NodeAllocator::template Pool<Node>;
+
     Node* head;    // Listenin başlangıç düğümü
     Node* tail;    // Listenin son düğümü
     size_t size;   // Liste uzunluğu
+    Allocator allocator;
+
+    Node* createNode(const T& value) {
+        void* memory = allocator.allocate();
+        try {
+            return new (memory) Node(value);
+        } catch (...) {
+            allocator.deallocate(memory);
+            throw;
+        }
+    }
+
+    void destroyNode(Node* node) {
+        node->~Node();
+        allocator.deallocate(node);
+    }
 
     // Özel yardımcı fonksiyonlar
     Node* getNode(size_t index) const {
@@ -29,51 +55,109 @@ private:
         return current;
     }
 
-    // İki sıralı alt listeyi birleştir
-    Node* merge(Node* left, Node* right) {
-        if (left == nullptr) return right;
-        if (right == nullptr) return left;
-        
+    // Sıralı bir alt liste: baş ve son düğüm
+    struct Run {
+        Node* first;
+        Node* last;
+    };
+
+    // İki sıralı alt listeyi iteratif olarak birleştir (kararlı: eşitlerde left önce).
+    // Düğümler yerinde yeniden bağlanır; son düğüm girişlerin son düğümlerinden bilinir.
+    static Run merge(Run left, Run right) {
+        if (left.first == nullptr) return right;
+        if (right.first == nullptr) return left;
+        Node* a = left.first;
+        Node* b = right.first;
         Node* result = nullptr;
-        
-        if (left->data <= right->data) {
-            result = left;
-            result->next = merge(left->next, right);
-        } else {
-            result = right;
-            result->next = merge(left, right->next);
+        Node** link = &result;   // Sıradaki düğümün yazılacağı next alanı
+        while (a != nullptr && b != nullptr) {
+            if (a->data <= b->data) {
+                *link = a;
+                link = &a->next;
+                a = a->next;
+            } else {
+                *link = b;
+                link = &b->next;
+                b = b->next;
+            }
         }
-        
-        return result;
+        *link = (a != nullptr) ? a : b;
+        return {result, (a != nullptr) ? left.last : right.last};
     }
 
-    // Merge sort için yardımcı fonksiyon
-    Node* mergeSortHelper(Node* head) {
-        if (head == nullptr || head->next == nullptr) {
-            return head;
+    // Listenin başından bir run ayırır: natural ise artan (eşitler dahil) en uzun önek, değilse tek düğüm
+    Run takeRun(bool natural) {
+        Node* first = head;
+        Node* last = head;
+        if (natural) {
+            while (last->next != nullptr && !(last->next->data < last->data)) {
+                last = last->next;
+            }
         }
-        
-        // Ortayı bul
-        Node* slow = head;
-        Node* fast = head->next;
-        while (fast != nullptr && fast->next != nullptr) {
-            slow = slow->next;
-            fast = fast->next->next;
+        head = last->next;
+        last->next = nullptr;
+        return {first, last};
+    }
+
+    // Iteratif merge sort: bins[i], 2^i run'lık sıralı liste. Her yeni run ikili sayaç gibi
+    // dolu bin'lerle birleşerek yukarı taşınır; birleştirilen listeler yakın zamanda dokunulmuş
+    // olduğundan her seviyede tüm listeyi yeniden yürüyen geçişlere göre cache dostudur.
+    // Rekürsiyon yok, ek bellek yalnızca 64 bin.
+    void sortRuns(bool natural) {
+        Run bins[64] = {};
+        while (head != nullptr) {
+            Run carry = takeRun(natural);
+            size_t i = 0;
+            for (; bins[i].first != nullptr; i++) {
+                carry = merge(bins[i], carry);  // bins[i] daha önceki elemanları tutar (kararlılık)
+                bins[i] = Run{nullptr, nullptr};
+            }
+            bins[i] = carry;
         }
-        
-        // Listeyi böl
-        Node* right = slow->next;
-        slow->next = nullptr;
-        
-        // Rekürsif olarak sırala
-        Node* left = mergeSortHelper(head);
-        right = mergeSortHelper(right);
-        
-        // Birleştir
-        return merge(left, right);
+        Run result = {nullptr, nullptr};
+        for (const Run& bin : bins) {
+            result = merge(bin, result);
+        }
+        head = result.first;
+        tail = result.last;
+    }
+
+    // k-way merge heap girdisi: bir listenin sıradaki düğümü ve listenin sırası
+    struct MergeHead {
+        Node* node;
+        size_t source;
+    };
+
+    // a, b'den sonra mı gelmeli (eşitlerde önceki liste önce: kararlı)
+    static bool after(const MergeHead& a, const MergeHead& b) {
+        if (b.node->data < a.node->data) return true;
+        if (a.node->data < b.node->data) return false;
+        return b.source < a.source;
+    }
+
+    static void siftDown(std::vector<MergeHead>& heap, size_t i) {
+        MergeHead moving = heap[i];
+        size_t n = heap.size();
+        while (2 * i + 1 < n) {
+            size_t child = 2 * i + 1;
+            if (child + 1 < n && after(heap[child], heap[child + 1])) child++;
+            if (!after(moving, heap[child])) break;
+            heap[i] = heap[child];
+            i = child;
+        }
+        heap[i] = moving;
+    }
+
+    // Düğümler başka listeye devredildikten sonra listeyi boşaltır (düğümler serbest bırakılmaz)
+    void release() {
+        head = tail = nullptr;
+        size = 0;
     }
 
 public:
+    // Düğüm başına bellek (allocator ek yükü hariç)
+    static constexpr size_t NODE_BYTES = sizeof(Node);
+
     // Yapıcı fonksiyon
     LinkedList() : head(nullptr), tail(nullptr), size(0) {}
 
@@ -86,6 +170,31 @@ public:
         }
     }
 
+    // Taşıma yapıcı fonksiyonu - düğümler devralınır (bkz. concat(LinkedList&&)).
+    // Devredilebilir havuzda noexcept: vector<LinkedList> büyürken listeleri kopyalamak yerine taşır.
+    LinkedList(LinkedList&& other) noexcept(Allocator::transferable) : head(nullptr), tail(nullptr), size(0) {
+        concat(std::move(other));
+    }
+
+    // Atama operatörü - mevcut düğümler bırakılıp diğer listenin elemanları kopyalanır
+    LinkedList& operator=(const LinkedList& other) {
+        if (this != &other) {
+            clear();
+            for (Node* current = other.head; current != nullptr; current = current->next) {
+                pushBack(current->data);
+            }
+        }
+        return *this;
+    }
+
+    LinkedList& operator=(LinkedList&& other) noexcept(Allocator::transferable) {
+        if (this != &other) {
+            clear();
+            concat(std::move(other));
+        }
+        return *this;
+    }
+
     // Yıkıcı fonksiyon
     ~LinkedList() {
         clear();
@@ -102,7 +211,7 @@ public:
 
     // Başa eleman ekleme
     void pushFront(const T& value) {
-        Node* newNode = new Node(value);
+        Node* newNode = createNode(value);
         if (empty()) {
             head = tail = newNode;
         } else {
@@ -113,7 +222,7 @@ public:
     }
 
     void pushBack(const T& value) {
-        Node* newNode = new Node(value);
+        Node* newNode = createNode(value);
         if (empty()) {
             head = tail = newNode;
         } else {
@@ -141,7 +250,7 @@ public:
             current = current->next;
         }
 
-        Node* newNode = new Node(value);
+        Node* newNode = createNode(value);
         newNode->next = current->next;
         current->next = newNode;
         size++;
@@ -153,7 +262,7 @@ public:
         }
         Node* temp = head;
         head = head->next;
-        delete temp;
+        destroyNode(temp);
         size--;
         if (empty()) {
             tail = nullptr;
@@ -165,7 +274,7 @@ public:
             throw std::runtime_error("List is empty");
         }
         if (size == 1) {
-            delete head;
+            destroyNode(head);
             head = tail = nullptr;
             size = 0;
             return;
@@ -174,7 +283,7 @@ public:
         while (current->next != tail) {
             current = current->next;
         }
-        delete tail;
+        destroyNode(tail);
         tail = current;
         tail->next = nullptr;
         size--;
@@ -196,7 +305,7 @@ public:
         Node* prev = getNode(index - 1);
         Node* temp = prev->next;
         prev->next = temp->next;
-        delete temp;
+        destroyNode(temp);
         size--;
     }
 
@@ -217,7 +326,7 @@ public:
                         tail = prev;
                     }
                 }
-                delete current;
+                destroyNode(current);
                 size--;
                 return;
             }
@@ -269,6 +378,54 @@ public:
         return getNode(index)->data;
     }
 
+    // STL uyumlu forward iterator (tek yönlü bağlantı; geri gitmek için DoublyLinkedList)
+    template <bool Const>
+    class Iterator {
+    private:
+        Node* node;
+        friend class LinkedList;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        Iterator() : node(nullptr) {}
+        explicit Iterator(Node* n) : node(n) {}
+        // iterator -> const_iterator dönüşümü
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        Iterator(const Iterator<OtherConst>& other) : node(other.node) {}
+
+        reference operator*() const { return node->data; }
+        pointer operator->() const { return &node->data; }
+        Iterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            node = node->next;
+            return previous;
+        }
+        bool operator==(const Iterator& other) const { return node == other.node; }
+        bool operator!=(const Iterator& other) const { return node != other.node; }
+
+        template <bool>
+        friend class Iterator;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return const_iterator(head); }
+    const_iterator cend() const { return const_iterator(nullptr); }
+
     // Arama operasyonları
     size_t find(const T& value) const {
         Node* current = head;
@@ -355,21 +512,41 @@ public:
         head = prev;
     }
 
+    // Bottom-up iteratif merge sort: O(n log n), kararlı, rekürsiyon ve ek bellek yok
     void sort() {
         if (size <= 1) return;
-        head = mergeSortHelper(head);
-        // Update tail
-        Node* current = head;
-        while (current->next != nullptr) {
-            current = current->next;
-        }
-        tail = current;
+        sortRuns(false);
+    }
+
+    // Natural merge sort: mevcut artan run'lar birleştirilir.
+    // Sıralı listede tek geçiş O(n); r run için O(n log r). Kararlı, ek bellek yok.
+    void sortNatural() {
+        if (size <= 1) return;
+        sortRuns(true);
     }
 
     void clear() {
-        while (!empty()) {
-            popFront();
+        if (Allocator::bulkClear) {
+            // Havuz topluca sıfırlanır; yıkıcısı önemsiz tiplerde düğümler hiç gezilmez
+            if (!std::is_trivially_destructible<T>::value) {
+                Node* current = head;
+                while (current != nullptr) {
+                    Node* next = current->next;  // Yıkıcıdan sonra düğüm okunmaz
+                    current->~Node();
+                    current = next;
+                }
+            }
+            allocator.reset();
+        } else {
+            Node* current = head;
+            while (current != nullptr) {
+                Node* next = current->next;
+                destroyNode(current);
+                current = next;
+            }
         }
+        head = tail = nullptr;
+        size = 0;
     }
 
     // Birleştirme operasyonları
@@ -381,6 +558,109 @@ public:
         }
     }
 
+    // Taşıyarak birleştirme: other'ın düğümleri kopyalanmadan sona bağlanır - O(1).
+    // Havuz listeye özelse (PoolNodeAllocator) düğümler devredilemez, elemanlar kopyalanır. other boş kalır.
+    void concat(LinkedList&& other) {
+        if (this == &other || other.empty()) return;
+        if (Allocator::transferable) {
+            if (tail == nullptr) {
+                head = other.head;
+            } else {
+                tail->next = other.head;
+            }
+            tail = other.tail;
+            size += other.size;
+            other.release();
+        } else {
+            concat(static_cast<const LinkedList&>(other));
+            other.clear();
+        }
+    }
+
+    // index ve sonrasındaki elemanları yeni bir listeye ayırır, bu listede [0, index) kalır - O(index)
+    LinkedList splitAt(size_t index) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        LinkedList result;
+        if (index == size) {
+            return result;
+        }
+        Node* last = (index == 0) ? nullptr : getNode(index - 1);
+        Node* first = (last == nullptr) ? head : last->next;
+        if (Allocator::transferable) {
+            result.head = first;
+            result.tail = tail;
+            result.size = size - index;
+        } else {
+            while (first != nullptr) {
+                Node* next = first->next;
+                result.pushBack(first->data);
+                destroyNode(first);
+                first = next;
+            }
+        }
+        if (last == nullptr) {
+            head = nullptr;
+        } else {
+            last->next = nullptr;
+        }
+        tail = last;
+        size = index;
+        return result;
+    }
+
+    // k sıralı listeyi tek sıralı listede birleştirir - O(N log k).
+    // Listelerin sıradaki düğümleri bir min-heap'te tutulur; eşitlerde önceki liste önce gelir.
+    // Düğümler devredilebiliyorsa kopyalanmadan yeniden bağlanır. Girdi listeleri boşalır.
+    static LinkedList mergeSorted(std::vector<LinkedList>&& lists) {
+        std::vector<MergeHead> heap;
+        heap.reserve(lists.size());
+        size_t total = 0;
+        for (size_t i = 0; i < lists.size(); i++) {
+            if (!lists[i].empty()) {
+                heap.push_back({lists[i].head, i});
+                total += lists[i].size;
+            }
+        }
+        for (size_t i = heap.size() / 2; i-- > 0;) {
+            siftDown(heap, i);
+        }
+
+        LinkedList result;
+        Node** link = &result.head;
+        while (!heap.empty()) {
+            Node* node = heap[0].node;
+            if (node->next != nullptr) {
+                heap[0].node = node->next;
+            } else {
+                heap[0] = heap.back();
+                heap.pop_back();
+            }
+            if (!heap.empty()) {
+                siftDown(heap, 0);
+            }
+            if (Allocator::transferable) {
+                *link = node;
+                link = &node->next;
+                result.tail = node;
+            } else {
+                result.pushBack(node->data);
+            }
+        }
+        if (Allocator::transferable) {
+            result.size = total;
+            for (LinkedList& list : lists) {
+                list.release();
+            }
+        } else {
+            for (LinkedList& list : lists) {
+                list.clear();
+            }
+        }
+        return result;
+    }
+
     LinkedList merge(const LinkedList& other) const {
         LinkedList result;
         Node* p1 = head;
@@ -421,20 +701,22 @@ public:
         return slow;
     }
 
+    // Ortak kuyruğun ilk düğümü: uzun liste uzunluk farkı kadar ilerletilir, sonra iki liste
+    // adım adım birlikte yürünür; ortak düğüm yoksa ikisi aynı anda nullptr'a ulaşır - O(n + m)
     Node* findIntersection(const LinkedList& other) const {
-        if (empty() || other.empty()) return nullptr;
         Node* current1 = head;
-        while (current1 != nullptr) {
-            Node* current2 = other.head;
-            while (current2 != nullptr) {
-                if (current1 == current2) {
-                    return current1;
-                }
-                current2 = current2->next;
-            }
+        Node* current2 = other.head;
+        for (size_t i = size; i > other.size; i--) {
+            current1 = current1->next;
+        }
+        for (size_t i = other.size; i > size; i--) {
+            current2 = current2->next;
+        }
+        while (current1 != current2) {
             current1 = current1->next;
+            current2 = current2->next;
         }
-        return nullptr;
+        return current1;
     }
 };
 
@@ -0,0 +1,278 @@
+#include "linked_list.h"
+#include "unrolled_list.h"
+#include "doubly_linked_list.h"
+#include "skip_list.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+// Ölçülen döngülerin sonucu; derleyicinin işi atmasını önlemek için sonda yazdırılır
+long long benchmarkSink = 0;
+
+// Fonksiyonu verilen sayıda çalıştırıp ortalama süreyi (ms) döndürür
+template <typename F>
+double measure(F&& f, int repeat) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeat; r++) {
+        f();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / repeat;
+}
+
+// Kuyruk benzeri churn: sona ekle, baştan çıkar; liste boyu window civarında kalır
+template <typename Allocator>
+double churn(size_t operations, size_t window) {
+    LinkedList<long long, Allocator> list;
+    return measure([&] {
+        for (size_t i = 0; i < operations; i++) {
+            list.pushBack(static_cast<long long>(i));
+            if (list.getSize() > window) {
+                benchmarkSink += list.front();
+                list.popFront();
+            }
+        }
+        list.clear();
+    }, 3);
+}
+
+// Çok sayıda kısa ömürlü liste: doldur, gez, yok et
+template <typename Allocator>
+double shortLived(size_t lists, size_t length) {
+    return measure([&] {
+        for (size_t l = 0; l < lists; l++) {
+            LinkedList<long long, Allocator> list;
+            for (size_t i = 0; i < length; i++) {
+                list.pushFront(static_cast<long long>(i + l));
+            }
+            benchmarkSink += list.getSum();
+        }
+    }, 3);
+}
+
+// Dolu listeyi rastgele indekslere ekleme/silme ile karıştırıp sonra gezme (düğüm dağınıklığı)
+template <typename Allocator>
+double scatteredTraversal(size_t length) {
+    LinkedList<long long, Allocator> list;
+    std::mt19937_64 rng(7);
+    for (size_t i = 0; i < length; i++) {
+        list.pushBack(static_cast<long long>(i));
+    }
+    for (size_t i = 0; i < length; i++) {
+        list.popFront();
+        list.pushBack(static_cast<long long>(rng() % 1000));
+    }
+    return measure([&] { benchmarkSink += list.getSum(); }, 10);
+}
+
+// Tek sıralama yöntemi: 0 bottom-up, 1 natural, 2 vektöre kopyala + std::sort + listeyi yeniden kur
+template <typename Allocator>
+double timeSort(const std::vector<long long>& values, int method) {
+    LinkedList<long long, Allocator> list;
+    for (long long v : values) list.pushBack(v);
+    return measure([&] {
+        if (method == 0) {
+            list.sort();
+        } else if (method == 1) {
+            list.sortNatural();
+        } else {
+            std::vector<long long> copy;
+            copy.reserve(list.getSize());
+            while (!list.empty()) {
+                copy.push_back(list.front());
+                list.popFront();
+            }
+            std::sort(copy.begin(), copy.end());
+            for (long long v : copy) list.pushBack(v);
+        }
+        benchmarkSink += list.front();
+    }, 1);
+}
+
+template <typename Allocator>
+void sortBenchmark(const char* label, const std::vector<long long>& random, const std::vector<long long>& nearly,
+                   const std::vector<long long>& sorted) {
+    const char* names[3] = {"rastgele", "neredeyse sıralı (%1 takas)", "sıralı"};
+    const std::vector<long long>* inputs[3] = {&random, &nearly, &sorted};
+    for (int k = 0; k < 3; k++) {
+        std::cout << label << ", " << names[k] << ": bottom-up " << timeSort<Allocator>(*inputs[k], 0)
+                  << " ms, natural " << timeSort<Allocator>(*inputs[k], 1) << " ms, vektör + std::sort "
+                  << timeSort<Allocator>(*inputs[k], 2) << " ms\n";
+    }
+}
+
+int main() {
+    const size_t operations = 4000000;
+    std::cout << "-- Push/pop churn (" << operations << " push + pop) --\n";
+    for (size_t window : {16, 1024, 1000000}) {
+        double heap = churn<HeapNodeAllocator>(operations, window);
+        double pool = churn<PoolNodeAllocator>(operations, window);
+        double shared = churn<SharedPoolNodeAllocator>(operations, window);
+        std::cout << "pencere " << window << ": new/delete " << heap << " ms, pool " << pool
+                  << " ms, shared pool " << shared << " ms (" << operations / (pool * 1e-3) / 1e6
+                  << " M push+pop/s pool)\n";
+    }
+
+    std::cout << "\n-- Kısa ömürlü listeler (10000 x 200 eleman) --\n";
+    {
+        double heap = shortLived<HeapNodeAllocator>(10000, 200);
+        double pool = shortLived<PoolNodeAllocator>(10000, 200);
+        double shared = shortLived<SharedPoolNodeAllocator>(10000, 200);
+        std::cout << "new/delete " << heap << " ms, pool " << pool << " ms, shared pool " << shared << " ms\n";
+    }
+
+    std::cout << "\n-- Churn sonrası gezinme (1M eleman, getSum) --\n";
+    {
+        double heap = scatteredTraversal<HeapNodeAllocator>(1000000);
+        double pool = scatteredTraversal<PoolNodeAllocator>(1000000);
+        std::cout << "new/delete " << heap << " ms, pool " << pool << " ms\n";
+    }
+    std::cout << "\n-- LinkedList vs UnrolledLinkedList (B = " << UnrolledLinkedList<long long>::BLOCK_CAPACITY
+              << ") --\n";
+    for (size_t length : {10000, 1000000}) {
+        LinkedList<long long> list;
+        UnrolledLinkedList<long long> unrolled;
+        std::mt19937_64 rng(9);
+        // Araya eklemelerle kurulum: bağlı listede düğümler heap'e dağılır
+        for (size_t i = 0; i < length; i++) {
+            long long value = static_cast<long long>(rng() % 1000000);
+            if (i % 2 == 0) {
+                list.pushBack(value);
+                unrolled.pushBack(value);
+            } else {
+                list.pushFront(value);
+                unrolled.pushFront(value);
+            }
+        }
+        int reps = length <= 10000 ? 200 : 5;
+        double listSum = measure([&] { benchmarkSink += list.getSum() + list.getMax() + list.getMin(); }, reps);
+        double unrolledSum = measure([&] { benchmarkSink += unrolled.getSum() + unrolled.getMax() + unrolled.getMin(); }, reps);
+        double listFind = measure([&] { benchmarkSink += static_cast<long long>(list.find(-1)); }, reps);
+        double unrolledFind = measure([&] { benchmarkSink += static_cast<long long>(unrolled.find(-1)); }, reps);
+        const size_t lookups = 200;
+        double listAt = measure([&] {
+            for (size_t k = 0; k < lookups; k++) benchmarkSink += list.at(rng() % length);
+        }, 1);
+        double unrolledAt = measure([&] {
+            for (size_t k = 0; k < lookups; k++) benchmarkSink += unrolled.at(rng() % length);
+        }, 1);
+        std::cout << "n = " << length << ": sum+max+min list " << listSum << " ms, unrolled " << unrolledSum
+                  << " ms | find (yok) list " << listFind << " ms, unrolled " << unrolledFind
+                  << " ms | " << lookups << " x at(i) list " << listAt << " ms, unrolled " << unrolledAt << " ms\n";
+    }
+
+    std::cout << "\n-- Sıralama (1M eleman) --\n";
+    {
+        const size_t length = 1000000;
+        std::mt19937_64 rng(21);
+        std::vector<long long> random(length), nearly(length), sorted(length);
+        for (auto& v : random) v = static_cast<long long>(rng() % 1000000000);
+        for (size_t i = 0; i < length; i++) nearly[i] = sorted[i] = static_cast<long long>(i);
+        for (size_t k = 0; k < length / 100; k++) std::swap(nearly[rng() % length], nearly[rng() % length]);
+        sortBenchmark<HeapNodeAllocator>("new/delete", random, nearly, sorted);
+        sortBenchmark<PoolNodeAllocator>("pool", random, nearly, sorted);
+    }
+
+    std::cout << "\n-- Deque kullanımı: pushBack + popBack (pencere 1000, 200K işlem) --\n";
+    {
+        const size_t window = 1000, operations = 200000;
+        auto run = [&](auto& list) {
+            return measure([&] {
+                for (size_t i = 0; i < window; i++) list.pushBack(static_cast<long long>(i));
+                for (size_t i = 0; i < operations; i++) {
+                    list.pushBack(static_cast<long long>(i));
+                    benchmarkSink += list.back();
+                    list.popBack();
+                }
+                list.clear();
+            }, 1);
+        };
+        LinkedList<long long> single;
+        DoublyLinkedList<long long> doubly;
+        double singleMs = run(single);
+        double doublyMs = run(doubly);
+        std::cout << "LinkedList (popBack O(n)) " << singleMs << " ms, DoublyLinkedList (O(1)) " << doublyMs << " ms\n";
+    }
+
+    std::cout << "\n-- Sıralı arama: LinkedList vs SkipList vs std::set --\n";
+    for (size_t length : {10000, 1000000}) {
+        std::mt19937_64 rng(31);
+        std::vector<long long> values(length);
+        for (auto& v : values) v = static_cast<long long>(rng() % 1000000000);
+        SkipList<long long> skip;
+        std::set<long long> tree;
+        double skipInsert = measure([&] { for (long long v : values) skip.insert(v); }, 1);
+        double treeInsert = measure([&] { for (long long v : values) tree.insert(v); }, 1);
+        const size_t lookups = 100000;
+        double skipFind = measure([&] {
+            for (size_t k = 0; k < lookups; k++) benchmarkSink += static_cast<long long>(skip.find(values[rng() % length]));
+        }, 1);
+        double treeFind = measure([&] {
+            for (size_t k = 0; k < lookups; k++) benchmarkSink += static_cast<long long>(tree.count(values[rng() % length]));
+        }, 1);
+        double skipAt = measure([&] {
+            for (size_t k = 0; k < lookups; k++) benchmarkSink += skip.at(rng() % skip.getSize());
+        }, 1);
+        LinkedList<long long> list;
+        for (long long v : skip) list.pushBack(v);
+        const size_t listLookups = 200;
+        double listFind = measure([&] {
+            for (size_t k = 0; k < listLookups; k++) benchmarkSink += static_cast<long long>(list.find(values[rng() % length]));
+        }, 1) * lookups / listLookups;
+        std::cout << "n = " << length << ": insert skip " << skipInsert << " ms, set " << treeInsert << " ms | "
+                  << lookups << " x find skip " << skipFind << " ms, set " << treeFind << " ms, list ~" << listFind
+                  << " ms | " << lookups << " x at(i) skip " << skipAt << " ms (seviye " << skip.getLevel() << ")\n";
+    }
+
+    std::cout << "\n-- Akış birleştirme: k sıralı liste, toplam 256K eleman --\n";
+    for (size_t k : {4, 64, 1024}) {
+        const size_t total = 1 << 18;
+        std::mt19937_64 rng(37);
+        auto makeLists = [&] {
+            std::vector<LinkedList<long long>> lists(k);
+            for (auto& list : lists) {
+                long long value = 0;
+                for (size_t i = 0; i < total / k; i++) {
+                    value += static_cast<long long>(rng() % 100);
+                    list.pushBack(value);
+                }
+            }
+            return lists;
+        };
+        auto lists = makeLists();
+        double heapMerge = measure([&] {
+            LinkedList<long long> merged = LinkedList<long long>::mergeSorted(std::move(lists));
+            benchmarkSink += merged.back();
+        }, 1);
+        lists = makeLists();
+        double pairwise = measure([&] {
+            LinkedList<long long> merged;
+            for (const auto& list : lists) merged = merged.merge(list);
+            benchmarkSink += merged.back();
+        }, 1);
+        std::cout << "k = " << k << ": mergeSorted (heap) " << heapMerge << " ms, art arda merge " << pairwise << " ms\n";
+    }
+    {
+        const size_t length = 1000000;
+        LinkedList<long long> base, copySource, moveSource;
+        for (size_t i = 0; i < length; i++) {
+            copySource.pushBack(static_cast<long long>(i));
+            moveSource.pushBack(static_cast<long long>(i));
+        }
+        double copyConcat = measure([&] { base.concat(copySource); }, 1);
+        double moveConcat = measure([&] { base.concat(std::move(moveSource)); }, 1);
+        std::cout << "1M eleman concat: kopyalayarak " << copyConcat << " ms, taşıyarak " << moveConcat << " ms\n";
+    }
+
+    std::cout << "\n-- Bellek (long long, allocator ek yükü hariç) --\n";
+    std::cout << "LinkedList düğümü " << LinkedList<long long>::NODE_BYTES << " B, DoublyLinkedList düğümü "
+              << DoublyLinkedList<long long>::NODE_BYTES << " B, UnrolledLinkedList eleman başına "
+              << UnrolledLinkedList<long long>::BYTES_PER_ELEMENT << " B (dolu blok)\n";
+
+    std::cout << "(" << benchmarkSink % 10 << ")\n";
+    return 0;
+}
@@ -1,6 +1,15 @@
 #include "linked_list.h"
+#include "unrolled_list.h"
+#include "doubly_linked_list.h"
+#include "skip_list.h"
+#include <algorithm>
+#include <numeric>
 #include <cassert>
 #include <string>
+#include <vector>
+#include <random>
+#include <set>
+#include <type_traits>
 
 // Temel operasyonların testi
 void testBasicOperations() {
@@ -175,6 +184,522 @@ void testStringOperations() {
     std::cout << "String operasyonları testleri başarılı!" << std::endl;
 }
 
+// Düğüm ayırma politikalarının testi
+template <typename Allocator>
+void checkAllocatorChurn() {
+    LinkedList<int, Allocator> list;
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 5000; i++) {
+            list.pushBack(i);
+            list.pushFront(-i);
+        }
+        for (int i = 0; i < 2500; i++) {
+            list.popFront();
+        }
+        list.insert(10, 42);
+        assert(list.at(10) == 42);
+        assert(list.getSize() == 7501);
+        list.remove(10);
+        assert(list.back() == 4999);
+        list.clear();
+        assert(list.empty());
+    }
+    
+    // Boşaltılan düğümlerin belleği sonraki eklemelerde yeniden kullanılır
+    for (int i = 0; i < 100; i++) {
+        list.pushBack(i);
+    }
+    LinkedList<int, Allocator> copy = list;
+    list.clear();
+    list.pushBack(7);
+    assert(copy.getSize() == 100 && copy.getSum() == 4950);
+    copy = list;
+    assert(copy.getSize() == 1 && copy.front() == 7);
+}
+
+void testNodeAllocators() {
+    checkAllocatorChurn<HeapNodeAllocator>();
+    checkAllocatorChurn<PoolNodeAllocator>();
+    checkAllocatorChurn<SharedPoolNodeAllocator>();
+    
+    // Yıkıcısı olan tiplerde toplu clear() yıkıcıları yine çağırır
+    LinkedList<std::string, PoolNodeAllocator> words;
+    for (int i = 0; i < 1000; i++) {
+        words.pushBack(std::string(40, static_cast<char>('a' + i % 26)));
+    }
+    words.clear();
+    words.pushBack("reuse");
+    assert(words.getSize() == 1 && words.front() == "reuse");
+    
+    // Paylaşılan havuz: bir listenin bıraktığı düğümler diğerine verilir
+    {
+        LinkedList<int, SharedPoolNodeAllocator> first;
+        for (int i = 0; i < 1000; i++) first.pushBack(i);
+    }
+    LinkedList<int, SharedPoolNodeAllocator> second;
+    for (int i = 0; i < 1000; i++) second.pushBack(i);
+    second.sort();
+    second.reverse();
+    assert(second.front() == 999 && second.back() == 0);
+    
+    // Slab havuzu: reset sonrası yeni slab ayrılmaz
+    NodePool<long long> pool;
+    std::vector<void*> slots;
+    for (int i = 0; i < 20000; i++) slots.push_back(pool.allocate());
+    size_t capacity = pool.capacity();
+    pool.reset();
+    for (int i = 0; i < 20000; i++) pool.allocate();
+    assert(pool.capacity() == capacity);
+    
+    // Devredilebilir havuzlarda taşıma noexcept: vector büyürken listeler kopyalanmaz
+    static_assert(std::is_nothrow_move_constructible<LinkedList<int, HeapNodeAllocator>>::value, "");
+    static_assert(std::is_nothrow_move_assignable<LinkedList<int, SharedPoolNodeAllocator>>::value, "");
+    static_assert(!std::is_nothrow_move_constructible<LinkedList<int, PoolNodeAllocator>>::value, "");
+    std::vector<LinkedList<int>> lists(1);
+    lists[0].pushBack(7);
+    const int* first = &lists[0].front();
+    lists.resize(100);
+    assert(&lists[0].front() == first);
+    
+    std::cout << "Düğüm havuzu testleri başarılı!" << std::endl;
+}
+
+// Unrolled linked list: rastgele işlemler std::vector referansıyla karşılaştırılır
+template <typename T, typename MakeValue>
+void checkUnrolledAgainstVector(MakeValue makeValue) {
+    UnrolledLinkedList<T> list;
+    std::vector<T> reference;
+    std::mt19937 rng(11);
+    for (int step = 0; step < 20000; step++) {
+        T value = makeValue(rng() % 1000);
+        switch (rng() % 7) {
+            case 0: list.pushBack(value); reference.push_back(value); break;
+            case 1: list.pushFront(value); reference.insert(reference.begin(), value); break;
+            case 2: {
+                size_t index = rng() % (reference.size() + 1);
+                list.insert(index, value);
+                reference.insert(reference.begin() + index, value);
+                break;
+            }
+            case 3:
+                if (!reference.empty()) {
+                    size_t index = rng() % reference.size();
+                    list.remove(index);
+                    reference.erase(reference.begin() + index);
+                }
+                break;
+            case 4:
+                if (!reference.empty()) { list.popFront(); reference.erase(reference.begin()); }
+                break;
+            case 5:
+                if (!reference.empty()) { list.popBack(); reference.pop_back(); }
+                break;
+            default: {
+                list.removeValue(value);
+                auto it = std::find(reference.begin(), reference.end(), value);
+                if (it != reference.end()) reference.erase(it);
+                break;
+            }
+        }
+        assert(list.getSize() == reference.size());
+        if (step % 500 == 0) {
+            for (size_t i = 0; i < reference.size(); i++) {
+                assert(list.at(i) == reference[i]);
+            }
+        }
+    }
+    // Blok dolulukları: boş blok yok, blok sayısı eleman sayısının makul bir kesri
+    assert(list.getBlockCount() <= reference.size());
+    
+    UnrolledLinkedList<T> sorted = list;
+    sorted.sort();
+    std::vector<T> expected = reference;
+    std::stable_sort(expected.begin(), expected.end());
+    for (size_t i = 0; i < expected.size(); i++) {
+        assert(sorted.at(i) == expected[i]);
+    }
+    list.reverse();
+    assert(list.front() == reference.back() && list.back() == reference.front());
+}
+
+void testUnrolledList() {
+    checkUnrolledAgainstVector<int>([](unsigned v) { return static_cast<int>(v); });
+    checkUnrolledAgainstVector<std::string>([](unsigned v) { return std::string(20, static_cast<char>('a' + v % 26)) + std::to_string(v); });
+    
+    UnrolledLinkedList<int> list;
+    for (int i = 1; i <= 100; i++) {
+        list.pushBack(i);
+    }
+    assert(list.getBlockCount() == (100 + UnrolledLinkedList<int>::BLOCK_CAPACITY - 1) / UnrolledLinkedList<int>::BLOCK_CAPACITY);
+    assert(list.getMax() == 100 && list.getMin() == 1 && list.getSum() == 5050);
+    assert(list.getAverage() == 50.5);
+    assert(list.find(42) == 41 && !list.contains(101));
+    assert(*list.findMiddle() == 51);
+    
+    UnrolledLinkedList<int> odd, even;
+    for (int i = 0; i < 50; i++) {
+        odd.pushBack(2 * i + 1);
+        even.pushBack(2 * i);
+    }
+    UnrolledLinkedList<int> merged = odd.merge(even);
+    for (int i = 0; i < 100; i++) {
+        assert(merged.at(i) == i);
+    }
+    odd.concat(even);
+    assert(odd.getSize() == 100 && odd.back() == 98);
+    
+    // Listedeki bir elemana referansla ekleme: kaydırma ve split'ten önce kopyalanmalı
+    const size_t capacity = UnrolledLinkedList<std::string>::BLOCK_CAPACITY;
+    UnrolledLinkedList<std::string> words;
+    for (size_t i = 0; i < capacity; i++) {
+        words.pushBack("word" + std::to_string(i));  // Tek dolu blok
+    }
+    words.pushFront(words.front());  // Dolu baş blok: yeni blok
+    assert(words.front() == "word0" && words.at(1) == "word0");
+    words.pushFront(words.front());  // Aynı blokta kaydırma: kaynak eleman yer değiştirir
+    assert(words.at(0) == "word0" && words.at(1) == "word0");
+    words.pushFront(words.at(3));    // Kaynak sonraki blokta
+    assert(words.front() == "word1" && words.at(1) == "word0");
+    words.pushBack(words.front());
+    assert(words.back() == "word1");
+    UnrolledLinkedList<std::string> full;
+    for (size_t i = 0; i < capacity; i++) {
+        full.pushBack("item" + std::to_string(i));
+    }
+    full.insert(0, full.at(capacity - 1));  // Dolu blokta split, kaynak üst yarıda
+    full.insert(1, full.at(capacity / 2));
+    assert(full.at(0) == "item" + std::to_string(capacity - 1));
+    assert(full.at(1) == "item" + std::to_string(capacity / 2 - 1));
+    assert(full.getSize() == capacity + 2 && full.at(capacity + 1) == "item" + std::to_string(capacity - 1));
+    
+    bool threw = false;
+    try { list.at(100); } catch (const std::out_of_range&) { threw = true; }
+    assert(threw);
+    list.clear();
+    threw = false;
+    try { list.popBack(); } catch (const std::runtime_error&) { threw = true; }
+    assert(threw);
+    
+    std::cout << "Unrolled linked list testleri başarılı!" << std::endl;
+}
+
+// Kararlılık kontrolü için: yalnızca key ile karşılaştırılır
+struct KeyedItem {
+    int key;
+    int order;
+    bool operator<(const KeyedItem& other) const { return key < other.key; }
+    bool operator<=(const KeyedItem& other) const { return key <= other.key; }
+};
+
+template <typename List>
+std::vector<KeyedItem> drain(List& list) {
+    std::vector<KeyedItem> items;
+    while (!list.empty()) {
+        items.push_back(list.front());
+        list.popFront();
+    }
+    return items;
+}
+
+// Iteratif ve natural merge sort testi
+void testIterativeSort() {
+    std::mt19937 rng(3);
+    const int n = 300000;  // Rekürsif merge bu boyutta stack'i taşırıyordu
+    for (int variant = 0; variant < 2; variant++) {
+        LinkedList<KeyedItem> list;
+        std::vector<KeyedItem> reference;
+        for (int i = 0; i < n; i++) {
+            KeyedItem item{static_cast<int>(rng() % 1000), i};
+            list.pushBack(item);
+            reference.push_back(item);
+        }
+        if (variant == 0) list.sort(); else list.sortNatural();
+        std::stable_sort(reference.begin(), reference.end());
+        assert(list.back().key == reference.back().key);
+        list.pushBack(KeyedItem{-1, -1});  // tail güncel olmalı
+        std::vector<KeyedItem> sorted = drain(list);
+        assert(sorted.size() == reference.size() + 1);
+        for (size_t i = 0; i < reference.size(); i++) {
+            assert(sorted[i].key == reference[i].key && sorted[i].order == reference[i].order);
+        }
+    }
+    
+    // Natural sort: sıralı, ters sıralı ve birkaç run'lı girdiler
+    LinkedList<int> presorted, reversed, runs;
+    for (int i = 0; i < 1000; i++) {
+        presorted.pushBack(i);
+        reversed.pushFront(i);
+        runs.pushBack((i % 250) * 4 + i / 250);
+    }
+    presorted.sortNatural();
+    reversed.sortNatural();
+    runs.sortNatural();
+    for (int i = 0; i < 1000; i++) {
+        assert(presorted.at(i) == i && reversed.at(i) == i && runs.at(i) == i);
+    }
+    assert(reversed.back() == 999 && runs.back() == 999);
+    
+    LinkedList<int> single;
+    single.sort();
+    single.pushBack(5);
+    single.sortNatural();
+    assert(single.front() == 5 && single.back() == 5);
+    
+    std::cout << "Iteratif sıralama testleri başarılı!" << std::endl;
+}
+
+// Çift yönlü liste ve iterator testleri
+template <typename Allocator>
+void checkDoublyAgainstVector() {
+    DoublyLinkedList<int, Allocator> list;
+    std::vector<int> reference;
+    std::mt19937 rng(19);
+    for (int step = 0; step < 20000; step++) {
+        int value = static_cast<int>(rng() % 1000);
+        switch (rng() % 6) {
+            case 0: list.pushBack(value); reference.push_back(value); break;
+            case 1: list.pushFront(value); reference.insert(reference.begin(), value); break;
+            case 2: {
+                size_t index = rng() % (reference.size() + 1);
+                list.insert(index, value);
+                reference.insert(reference.begin() + index, value);
+                break;
+            }
+            case 3:
+                if (!reference.empty()) {
+                    size_t index = rng() % reference.size();
+                    list.remove(index);
+                    reference.erase(reference.begin() + index);
+                }
+                break;
+            case 4:
+                if (!reference.empty()) { list.popBack(); reference.pop_back(); }
+                break;
+            default:
+                if (!reference.empty()) { list.popFront(); reference.erase(reference.begin()); }
+                break;
+        }
+        assert(list.getSize() == reference.size());
+    }
+    assert(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    assert(std::equal(list.rbegin(), list.rend(), reference.rbegin(), reference.rend()));
+    
+    // <algorithm> doğrudan liste üzerinde
+    std::reverse(list.begin(), list.end());
+    std::reverse(reference.begin(), reference.end());
+    assert(std::equal(list.begin(), list.end(), reference.begin()));
+    list.reverse();
+    std::reverse(reference.begin(), reference.end());
+    assert(std::equal(list.begin(), list.end(), reference.begin()));
+    list.sort();
+    std::stable_sort(reference.begin(), reference.end());
+    assert(std::equal(list.begin(), list.end(), reference.begin()));
+    assert(std::is_sorted(list.cbegin(), list.cend()));
+    
+    // Iterator ile gezerken silme: çift sayıları at
+    for (auto it = list.begin(); it != list.end();) {
+        it = (*it % 2 == 0) ? list.erase(it) : std::next(it);
+    }
+    reference.erase(std::remove_if(reference.begin(), reference.end(), [](int v) { return v % 2 == 0; }), reference.end());
+    assert(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    if (!reference.empty()) {
+        assert(list.back() == reference.back());
+        assert(*std::prev(list.end()) == reference.back());
+    }
+}
+
+void testDoublyLinkedList() {
+    checkDoublyAgainstVector<HeapNodeAllocator>();
+    checkDoublyAgainstVector<PoolNodeAllocator>();
+    
+    DoublyLinkedList<int> list;
+    for (int i = 1; i <= 5; i++) {
+        list.pushBack(i);
+    }
+    assert(std::accumulate(list.begin(), list.end(), 0) == 15);
+    assert(*list.findMiddle() == 3);
+    auto it = std::find(list.begin(), list.end(), 3);
+    it = list.insert(it, 10);  // 1 2 10 3 4 5
+    assert(*it == 10 && list.at(2) == 10 && list.getSize() == 6);
+    list.erase(it);
+    assert(list.getMax() == 5 && list.getMin() == 1 && list.getAverage() == 3.0);
+    
+    DoublyLinkedList<std::string> words;
+    words.pushBack("b");
+    words.pushFront("a");
+    words.pushBack("c");
+    DoublyLinkedList<std::string> copy = words;
+    copy.popBack();
+    assert(words.back() == "c" && copy.back() == "b");
+    assert(words.merge(copy).getSize() == 5);
+    
+    // Tek yönlü LinkedList forward iterator'ları
+    LinkedList<int> single;
+    for (int i = 1; i <= 5; i++) {
+        single.pushBack(i);
+    }
+    assert(std::accumulate(single.begin(), single.end(), 0) == 15);
+    assert(*std::max_element(single.cbegin(), single.cend()) == 5);
+    for (int& value : single) {
+        value *= 2;
+    }
+    assert(single.getSum() == 30);
+    const LinkedList<int>& constSingle = single;
+    assert(std::count_if(constSingle.begin(), constSingle.end(), [](int v) { return v > 4; }) == 3);
+    
+    std::cout << "Çift yönlü liste ve iterator testleri başarılı!" << std::endl;
+}
+
+// Skip list'in rastgele ekleme/silme altında std::set ile aynı sırayı ve sıra numaralarını koruması
+void testSkipList() {
+    SkipList<int> list;
+    std::set<int> reference;
+    std::mt19937 rng(23);
+    for (int step = 0; step < 40000; step++) {
+        int value = static_cast<int>(rng() % 5000);
+        if (rng() % 3 != 0) {
+            assert(list.insert(value) == reference.insert(value).second);
+        } else {
+            assert(list.removeValue(value) == (reference.erase(value) == 1));
+        }
+        assert(list.getSize() == reference.size());
+    }
+    assert(std::equal(list.begin(), list.end(), reference.begin(), reference.end()));
+    
+    std::vector<int> sorted(reference.begin(), reference.end());
+    for (size_t i = 0; i < sorted.size(); i += 7) {
+        assert(list.at(i) == sorted[i]);
+        assert(list.find(sorted[i]) == i);
+    }
+    for (int value = -1; value <= 5001; value += 13) {
+        size_t lower = static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+        assert(list.rank(value) == lower);
+        assert(list.contains(value) == (reference.count(value) == 1));
+        assert(list.find(value) == (list.contains(value) ? lower : list.getSize()));
+    }
+    
+    // Aralık gezinme ve sayma
+    std::vector<int> range(list.lowerBound(1000), list.upperBound(2000));
+    std::vector<int> expected(reference.lower_bound(1000), reference.upper_bound(2000));
+    assert(range == expected);
+    assert(list.countRange(1000, 2000) == expected.size());
+    assert(list.countRange(2000, 1000) == 0);
+    
+    // Konuma göre silme
+    while (list.getSize() > 10) {
+        size_t index = rng() % list.getSize();
+        sorted.erase(sorted.begin() + index);
+        list.remove(index);
+    }
+    assert(std::equal(list.begin(), list.end(), sorted.begin(), sorted.end()));
+    assert(list.front() == sorted.front() && list.back() == sorted.back());
+    
+    SkipList<std::string> words;
+    words.insert("kiraz");
+    words.insert("elma");
+    words.insert("armut");
+    assert(!words.insert("elma"));
+    SkipList<std::string> copy = words;
+    copy.popFront();
+    assert(words.front() == "armut" && copy.front() == "elma" && copy[1] == "kiraz");
+    words.clear();
+    assert(words.empty() && words.getLevel() == 1);
+    
+    bool thrown = false;
+    try {
+        words.at(0);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    std::cout << "Skip list testleri başarılı!" << std::endl;
+}
+
+template <typename Allocator>
+void checkBulkOperations() {
+    using List = LinkedList<int, Allocator>;
+    List a, b;
+    for (int i = 0; i < 5; i++) a.pushBack(i);
+    for (int i = 5; i < 8; i++) b.pushBack(i);
+    a.concat(std::move(b));
+    assert(a.getSize() == 8 && b.empty() && a.back() == 7);
+    b.pushBack(100);  // Boşaltılan liste yeniden kullanılabilir
+    assert(b.getSize() == 1 && b.front() == 100);
+    
+    List tail = a.splitAt(3);
+    assert(a.getSize() == 3 && a.back() == 2 && tail.getSize() == 5 && tail.front() == 3 && tail.back() == 7);
+    tail.pushBack(8);
+    a.pushBack(50);
+    assert(tail.getSum() == 3 + 4 + 5 + 6 + 7 + 8 && a.getSum() == 0 + 1 + 2 + 50);
+    List all = a.splitAt(0);
+    assert(a.empty() && all.getSize() == 4);
+    assert(all.splitAt(4).empty());
+    bool thrown = false;
+    try {
+        all.splitAt(5);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+    
+    List moved = std::move(all);
+    assert(moved.getSize() == 4 && all.empty());
+    
+    // k-way merge: rastgele sıralı listeler, sonuç std::stable_sort ile karşılaştırılır
+    std::mt19937 rng(29);
+    std::vector<List> lists(37);
+    std::vector<int> expected;
+    for (size_t k = 0; k < lists.size(); k++) {
+        size_t length = (k % 5 == 0) ? 0 : rng() % 300;
+        std::vector<int> values(length);
+        for (int& v : values) v = static_cast<int>(rng() % 200);
+        std::sort(values.begin(), values.end());
+        for (int v : values) {
+            lists[k].pushBack(v);
+            expected.push_back(v);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    List merged = List::mergeSorted(std::move(lists));
+    assert(merged.getSize() == expected.size());
+    assert(std::equal(merged.begin(), merged.end(), expected.begin(), expected.end()));
+    merged.pushBack(1000);
+    assert(merged.back() == 1000);
+    assert(List::mergeSorted(std::vector<List>()).empty());
+}
+
+// Taşıyarak birleştirme, bölme, k-way merge ve kesişim
+void testBulkOperations() {
+    checkBulkOperations<HeapNodeAllocator>();
+    checkBulkOperations<PoolNodeAllocator>();
+    checkBulkOperations<SharedPoolNodeAllocator>();
+    
+    // k-way merge kararlılığı: eşit anahtarlarda önceki liste önce
+    std::vector<LinkedList<KeyedItem>> lists(3);
+    for (int k = 0; k < 3; k++) {
+        for (int key = 0; key < 4; key++) {
+            lists[k].pushBack(KeyedItem{key, k});
+        }
+    }
+    LinkedList<KeyedItem> merged = LinkedList<KeyedItem>::mergeSorted(std::move(lists));
+    int order = 0;
+    for (const KeyedItem& item : merged) {
+        assert(item.key == order / 3 && item.order == order % 3);
+        order++;
+    }
+    
+    // Ayrı listeler düğüm paylaşmaz; liste kendisiyle tüm düğümlerinde kesişir
+    LinkedList<int> first, second;
+    for (int i = 0; i < 10; i++) first.pushBack(i);
+    for (int i = 0; i < 4; i++) second.pushBack(i);
+    assert(first.findIntersection(second) == nullptr);
+    assert(first.findIntersection(first) != nullptr && first.findIntersection(first)->data == 0);
+    assert(first.findIntersection(LinkedList<int>()) == nullptr);
+    
+    std::cout << "Toplu operasyon testleri başarılı!" << std::endl;
+}
+
 int main() {
     try {
         testBasicOperations();
@@ -185,6 +710,12 @@ int main() {
         testMergeOperations();
         testSpecialOperations();
         testStringOperations();
+        testNodeAllocators();
+        testUnrolledList();
+        testIterativeSort();
+        testDoublyLinkedList();
+        testSkipList();
+        testBulkOperations();
         
         std::cout << "\nTüm testler başarıyla tamamlandı!" << std::endl;
     } catch (const std::exception& e) {
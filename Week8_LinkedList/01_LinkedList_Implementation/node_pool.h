@@ -0,0 +1,142 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Bir slab'ın hedef boyutu; düğümler bu büyüklükteki bloklardan ardışık olarak dağıtılır
+constexpr size_t NODE_POOL_SLAB_BYTES = 64 * 1024;
+
+// Sabit boyutlu düğümler için slab havuzu.
+// Düğümler büyük bloklardan (slab) sırayla verilir, geri verilenler bir free-list'te tutulur.
+// Böylece her ekleme/silme malloc/free yerine birkaç pointer işlemidir ve düğümler bellekte yakın durur.
+template <typename Node>
+class NodePool {
+private:
+    // Boş slot free-list'in bir sonraki elemanını tutar, dolu slot bir Node taşır
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    static constexpr size_t SLOTS_PER_SLAB =
+        sizeof(Slot) >= NODE_POOL_SLAB_BYTES ? 1 : NODE_POOL_SLAB_BYTES / sizeof(Slot);
+
+    std::vector<std::unique_ptr<Slot[]>> slabs;
+    Slot* freeList;      // Geri verilmiş slotlar
+    size_t activeSlab;   // Bump allocation yapılan slab
+    size_t bumpIndex;    // activeSlab içinde sıradaki hiç kullanılmamış slot
+
+public:
+    NodePool() : freeList(nullptr), activeSlab(0), bumpIndex(SLOTS_PER_SLAB) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // Node için başlatılmamış bellek; yapıcı placement new ile çağrılır
+    void* allocate() {
+        if (freeList != nullptr) {
+            Slot* slot = freeList;
+            freeList = slot->next;
+            return slot->storage;
+        }
+        if (bumpIndex == SLOTS_PER_SLAB) {
+            // reset() sonrası eldeki slab'lar yeniden kullanılır, yoksa yenisi ayrılır
+            if (!slabs.empty() && activeSlab + 1 < slabs.size()) {
+                ++activeSlab;
+            } else {
+                slabs.emplace_back(new Slot[SLOTS_PER_SLAB]);
+                activeSlab = slabs.size() - 1;
+            }
+            bumpIndex = 0;
+        }
+        return slabs[activeSlab][bumpIndex++].storage;
+    }
+
+    // Yıkıcısı çağrılmış düğümün belleğini free-list'e geri verir
+    void deallocate(void* node) {
+        Slot* slot = static_cast<Slot*>(node);
+        slot->next = freeList;
+        freeList = slot;
+    }
+
+    // Tüm düğümleri tek seferde serbest bırakır (yıkıcılar çağrılmaz); slab'lar yeniden kullanılmak üzere tutulur
+    void reset() {
+        freeList = nullptr;
+        activeSlab = 0;
+        bumpIndex = slabs.empty() ? SLOTS_PER_SLAB : 0;
+    }
+
+    // Slab belleğini sisteme iade eder; canlı düğüm kalmamış olmalıdır
+    void release() {
+        slabs.clear();
+        freeList = nullptr;
+        activeSlab = 0;
+        bumpIndex = SLOTS_PER_SLAB;
+    }
+
+    // Ayrılmış toplam slot sayısı
+    size_t capacity() const {
+        return slabs.size() * SLOTS_PER_SLAB;
+    }
+};
+
+// Düğüm ayırma politikaları - LinkedList<T, NodeAllocator> ikinci template parametresi.
+// Her politika, düğüm tipine göre allocate/deallocate/clear sağlayan bir Pool<Node> şablonu tanımlar.
+// bulkClear true ise clear() düğümleri tek tek geri vermek yerine havuzu topluca sıfırlar.
+// transferable true ise düğümler aynı tipli başka bir listeye kopyalanmadan devredilebilir (splice).
+
+// Her düğüm için ayrı new/delete (varsayılan, önceki davranış)
+struct HeapNodeAllocator {
+    template <typename Node>
+    struct Pool {
+        static constexpr bool bulkClear = false;
+        static constexpr bool transferable = true;
+        void* allocate() { return ::operator new(sizeof(Node)); }
+        void deallocate(void* node) { ::operator delete(node); }
+        void reset() {}
+    };
+};
+
+// Listeye özel slab havuzu; clear() tüm düğümleri tek adımda serbest bırakır.
+// Liste kopyalanınca kopya kendi havuzunu kurar.
+struct PoolNodeAllocator {
+    template <typename Node>
+    struct Pool {
+        static constexpr bool bulkClear = true;
+        static constexpr bool transferable = false;  // Düğümler bu listenin slab'larında yaşar
+        NodePool<Node> pool;
+
+        Pool() = default;
+        Pool(const Pool&) {}
+        Pool& operator=(const Pool&) = delete;
+
+        void* allocate() { return pool.allocate(); }
+        void deallocate(void* node) { pool.deallocate(node); }
+        void reset() { pool.reset(); }
+    };
+};
+
+// Aynı thread'deki aynı düğüm tipli tüm listelerin paylaştığı thread_local havuz.
+// Çok sayıda kısa ömürlü liste için slab'lar listeler arasında yeniden kullanılır.
+// Düğümler ayrıldıkları thread'de serbest bırakılmalı ve liste o thread'den uzun yaşamamalıdır.
+struct SharedPoolNodeAllocator {
+    template <typename Node>
+    struct Pool {
+        static constexpr bool bulkClear = false;
+        static constexpr bool transferable = true;
+
+        static NodePool<Node>& local() {
+            thread_local NodePool<Node> pool;
+            return pool;
+        }
+
+        void* allocate() { return local().allocate(); }
+        void deallocate(void* node) { local().deallocate(node); }
+        void reset() {}
+    };
+};
+
+#endif // NODE_POOL_H
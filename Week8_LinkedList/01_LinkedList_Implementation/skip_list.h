@@ -0,0 +1,379 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+
+// En fazla seviye; p = 1/4 ile 4^32 elemana kadar beklenen O(log n) korunur
+constexpr size_t SKIP_LIST_MAX_LEVEL = 32;
+
+// Sıralı küme (tekrarsız) - indekslenebilir skip list.
+// Her düğüm rastgele yükseklikte bir bağlantı kulesi taşır; üst seviyeler alt seviyeleri atlayan ekspres hatlardır.
+// Her bağlantı atladığı eleman sayısını (width) da tutar, böylece arama/ekleme/silme yanında
+// at(i) ve find (sıra numarası) de beklenen O(log n) olur.
+// Eşzamanlı kullanım: yazıcı yokken birden fazla thread const fonksiyonları aynı anda çağırabilir.
+template <typename T>
+class SkipList {
+private:
+    struct Node;
+
+    // Seviyedeki sonraki düğüm ve oraya kadar alt seviyede atlanan eleman sayısı
+    struct Link {
+        Node* next;
+        size_t width;
+    };
+
+    // Bağlantı dizisi düğümün hemen arkasında, düğümle tek blokta ayrılır
+    struct Node {
+        T data;
+        size_t height;
+
+        Node(const T& value, size_t h) : data(value), height(h) {}
+
+        Link* links() { return reinterpret_cast<Link*>(this + 1); }
+        const Link* links() const { return reinterpret_cast<const Link*>(this + 1); }
+    };
+
+    static_assert(alignof(Node) >= alignof(Link), "Link array must be aligned after Node");
+
+    Link head[SKIP_LIST_MAX_LEVEL];  // Başlangıç kulesi (veri taşımaz)
+    size_t level;                    // Kullanılan seviye sayısı
+    size_t size;
+    uint64_t randomState;            // Seviye seçimi için xorshift durumu
+
+    static Node* createNode(const T& value, size_t height) {
+        void* memory = ::operator new(sizeof(Node) + height * sizeof(Link));
+        try {
+            return new (memory) Node(value, height);
+        } catch (...) {
+            ::operator delete(memory);
+            throw;
+        }
+    }
+
+    static void destroyNode(Node* node) {
+        node->~Node();
+        ::operator delete(node);
+    }
+
+    // Düğümün bağlantı dizisi; nullptr başlangıç kulesini gösterir
+    Link* linksOf(Node* node) {
+        return node == nullptr ? head : node->links();
+    }
+
+    const Link* linksOf(const Node* node) const {
+        return node == nullptr ? head : node->links();
+    }
+
+    // Her seviye 1/4 olasılıkla bir üste çıkar
+    size_t randomHeight() {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        uint64_t bits = randomState;
+        size_t height = 1;
+        while ((bits & 3) == 0 && height < SKIP_LIST_MAX_LEVEL) {
+            height++;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    // value'dan küçük son düğümü (yoksa nullptr) her seviye için update'e, sıra numarasını rank'e yazar.
+    // Sıra numarası 1 tabanlıdır; başlangıç kulesi 0'dır.
+    void findPredecessors(const T& value, Node** update, size_t* rank) {
+        Node* current = nullptr;
+        size_t position = 0;
+        for (size_t i = level; i-- > 0;) {
+            Link* links = linksOf(current);
+            while (links[i].next != nullptr && links[i].next->data < value) {
+                position += links[i].width;
+                current = links[i].next;
+                links = current->links();
+            }
+            update[i] = current;
+            rank[i] = position;
+        }
+    }
+
+    // value'dan küçük olmayan ilk düğüm ve ondan önceki eleman sayısı
+    const Node* lowerBoundNode(const T& value, size_t& position) const {
+        const Node* current = nullptr;
+        position = 0;
+        for (size_t i = level; i-- > 0;) {
+            const Link* links = linksOf(current);
+            while (links[i].next != nullptr && links[i].next->data < value) {
+                position += links[i].width;
+                current = links[i].next;
+                links = current->links();
+            }
+        }
+        return linksOf(current)[0].next;
+    }
+
+public:
+    class const_iterator {
+    private:
+        const Node* node;
+        friend class SkipList;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : node(nullptr) {}
+        explicit const_iterator(const Node* n) : node(n) {}
+
+        reference operator*() const { return node->data; }
+        pointer operator->() const { return &node->data; }
+        const_iterator& operator++() {
+            node = node->links()[0].next;
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            node = node->links()[0].next;
+            return previous;
+        }
+        bool operator==(const const_iterator& other) const { return node == other.node; }
+        bool operator!=(const const_iterator& other) const { return node != other.node; }
+    };
+
+    // Elemanlar sıralı olduğundan yalnızca const iterator verilir
+    using iterator = const_iterator;
+
+    // Yapıcı fonksiyon
+    SkipList() : level(1), size(0), randomState(0x9E3779B97F4A7C15ull) {
+        for (size_t i = 0; i < SKIP_LIST_MAX_LEVEL; i++) {
+            head[i] = {nullptr, 0};
+        }
+    }
+
+    // Kopyalama yapıcı fonksiyonu
+    SkipList(const SkipList& other) : SkipList() {
+        for (const T& value : other) {
+            insert(value);
+        }
+    }
+
+    SkipList& operator=(const SkipList& other) {
+        if (this != &other) {
+            clear();
+            for (const T& value : other) {
+                insert(value);
+            }
+        }
+        return *this;
+    }
+
+    // Yıkıcı fonksiyon
+    ~SkipList() {
+        clear();
+    }
+
+    // Iterator'lar (artan sıra)
+    const_iterator begin() const { return const_iterator(head[0].next); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // Temel operasyonlar
+    bool empty() const {
+        return size == 0;
+    }
+
+    size_t getSize() const {
+        return size;
+    }
+
+    size_t getLevel() const {
+        return level;
+    }
+
+    // Eleman ekler; zaten varsa false döner - beklenen O(log n)
+    bool insert(const T& value) {
+        Node* update[SKIP_LIST_MAX_LEVEL];
+        size_t rank[SKIP_LIST_MAX_LEVEL];
+        findPredecessors(value, update, rank);
+
+        Node* next = linksOf(update[0])[0].next;
+        if (next != nullptr && !(value < next->data)) {
+            return false;
+        }
+
+        size_t height = randomHeight();
+        if (height > level) {
+            for (size_t i = level; i < height; i++) {
+                update[i] = nullptr;
+                rank[i] = 0;
+                head[i].width = size + 1;
+            }
+            level = height;
+        }
+
+        Node* node = createNode(value, height);
+        size_t position = rank[0] + 1;  // Yeni düğümün sıra numarası
+        for (size_t i = 0; i < height; i++) {
+            Link& previous = linksOf(update[i])[i];
+            node->links()[i] = {previous.next, previous.width - (position - rank[i]) + 1};
+            previous = {node, position - rank[i]};
+        }
+        // Yeni düğümün üstünden geçen bağlantılar bir eleman daha atlar
+        for (size_t i = height; i < level; i++) {
+            linksOf(update[i])[i].width++;
+        }
+        size++;
+        return true;
+    }
+
+    // Elemanı siler; yoksa false döner - beklenen O(log n)
+    bool removeValue(const T& value) {
+        Node* update[SKIP_LIST_MAX_LEVEL];
+        size_t rank[SKIP_LIST_MAX_LEVEL];
+        findPredecessors(value, update, rank);
+
+        Node* target = linksOf(update[0])[0].next;
+        if (target == nullptr || value < target->data) {
+            return false;
+        }
+
+        for (size_t i = 0; i < level; i++) {
+            Link& previous = linksOf(update[i])[i];
+            if (previous.next == target) {
+                previous.width += target->links()[i].width - 1;
+                previous.next = target->links()[i].next;
+            } else {
+                previous.width--;
+            }
+        }
+        destroyNode(target);
+        while (level > 1 && head[level - 1].next == nullptr) {
+            level--;
+        }
+        size--;
+        return true;
+    }
+
+    // index'teki elemanı siler - beklenen O(log n)
+    void remove(size_t index) {
+        removeValue(T(at(index)));
+    }
+
+    void popFront() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        remove(0);
+    }
+
+    // Erişim operasyonları
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head[0].next->data;
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return at(size - 1);
+    }
+
+    // Sıradaki index'inci eleman; genişlikler toplanarak inilir - beklenen O(log n)
+    const T& at(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        const Node* current = nullptr;
+        size_t position = 0;
+        size_t target = index + 1;
+        for (size_t i = level; i-- > 0;) {
+            const Link* links = linksOf(current);
+            while (links[i].next != nullptr && position + links[i].width <= target) {
+                position += links[i].width;
+                current = links[i].next;
+                links = current->links();
+            }
+        }
+        return current->data;
+    }
+
+    const T& operator[](size_t index) const {
+        return at(index);
+    }
+
+    // Arama operasyonları
+    // Elemanın sıra numarası; yoksa getSize() (LinkedList::find ile aynı sözleşme)
+    size_t find(const T& value) const {
+        size_t position;
+        const Node* node = lowerBoundNode(value, position);
+        if (node == nullptr || value < node->data) {
+            return size;
+        }
+        return position;
+    }
+
+    bool contains(const T& value) const {
+        return find(value) != size;
+    }
+
+    // value'dan küçük eleman sayısı
+    size_t rank(const T& value) const {
+        size_t position;
+        lowerBoundNode(value, position);
+        return position;
+    }
+
+    // Aralık sorguları: [lowerBound(a), upperBound(b)) a ile b arasındaki elemanları gezer
+    const_iterator lowerBound(const T& value) const {
+        size_t position;
+        return const_iterator(lowerBoundNode(value, position));
+    }
+
+    const_iterator upperBound(const T& value) const {
+        size_t position;
+        const Node* node = lowerBoundNode(value, position);
+        if (node != nullptr && !(value < node->data)) {
+            node = node->links()[0].next;
+        }
+        return const_iterator(node);
+    }
+
+    // [low, high] aralığındaki eleman sayısı - iki arama, O(log n)
+    size_t countRange(const T& low, const T& high) const {
+        if (high < low) {
+            return 0;
+        }
+        size_t upper;
+        const Node* node = lowerBoundNode(high, upper);
+        if (node != nullptr && !(high < node->data)) {
+            upper++;
+        }
+        return upper - rank(low);
+    }
+
+    // Liste manipülasyonu
+    void clear() {
+        Node* current = head[0].next;
+        while (current != nullptr) {
+            Node* next = current->links()[0].next;
+            destroyNode(current);
+            current = next;
+        }
+        for (size_t i = 0; i < SKIP_LIST_MAX_LEVEL; i++) {
+            head[i] = {nullptr, 0};
+        }
+        level = 1;
+        size = 0;
+    }
+};
+
+#endif // SKIP_LIST_H
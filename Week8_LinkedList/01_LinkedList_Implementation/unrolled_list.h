@@ -0,0 +1,514 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <algorithm>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Bir bloğun hedef boyutu: iki cache line. Eleman dizisi bu boyuttan blok başlığı düşülerek hesaplanır.
+constexpr size_t UNROLLED_BLOCK_BYTES = 128;
+
+// Unrolled linked list - her düğüm (blok) küçük bir eleman dizisi tutar.
+// LinkedList ile aynı genel API; gezinme düğüm başına değil blok başına bir cache miss öder,
+// indeks erişimi blokları eleman sayılarına bakarak atlar (O(n / B)).
+template <typename T>
+class UnrolledLinkedList {
+public:
+    static constexpr size_t BLOCK_CAPACITY =
+        (UNROLLED_BLOCK_BYTES - 2 * sizeof(void*)) / sizeof(T) >= 4
+            ? (UNROLLED_BLOCK_BYTES - 2 * sizeof(void*)) / sizeof(T)
+            : 4;
+
+private:
+    // Blok yapısı; elemanlar storage içinde placement new ile [0, count) aralığında yaşar
+    struct Block {
+        Block* next;
+        size_t count;
+        alignas(T) unsigned char storage[BLOCK_CAPACITY * sizeof(T)];
+
+        Block() : next(nullptr), count(0) {}
+
+        T* items() { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* items() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+        bool full() const { return count == BLOCK_CAPACITY; }
+    };
+
+public:
+    // Dolu bir blokta eleman başına bellek
+    static constexpr size_t BYTES_PER_ELEMENT = (sizeof(Block) + BLOCK_CAPACITY - 1) / BLOCK_CAPACITY;
+
+private:
+    Block* head;        // İlk blok
+    Block* tail;        // Son blok
+    size_t size;        // Toplam eleman sayısı
+    size_t blockCount;  // Blok sayısı
+
+    // Bir elemanın konumu: blok, blok içi sıra ve (bağlantıyı koparmak için) önceki blok
+    struct Position {
+        Block* prev;
+        Block* block;
+        size_t offset;
+    };
+
+    // index < size olmalı; bloklar eleman sayılarıyla atlanır
+    Position locate(size_t index) const {
+        Block* prev = nullptr;
+        Block* current = head;
+        while (index >= current->count) {
+            index -= current->count;
+            prev = current;
+            current = current->next;
+        }
+        return {prev, current, index};
+    }
+
+    Block* appendBlock() {
+        Block* block = new Block();
+        if (tail == nullptr) {
+            head = tail = block;
+        } else {
+            tail->next = block;
+            tail = block;
+        }
+        blockCount++;
+        return block;
+    }
+
+    // Bloğun pos konumuna eleman yerleştirir; blok dolu olmamalı.
+    // value listedeki bir elemana referans olmamalı: çağıranlar önce yerel kopya alır
+    // (kaydırma ve split o elemanı taşıyabilir).
+    static void insertAt(Block* block, size_t pos, T&& value) {
+        T* items = block->items();
+        if (pos == block->count) {
+            new (items + pos) T(std::move(value));
+        } else {
+            new (items + block->count) T(std::move(items[block->count - 1]));
+            std::move_backward(items + pos, items + block->count - 1, items + block->count);
+            items[pos] = std::move(value);
+        }
+        block->count++;
+    }
+
+    static void eraseAt(Block* block, size_t pos) {
+        T* items = block->items();
+        std::move(items + pos + 1, items + block->count, items + pos);
+        items[block->count - 1].~T();
+        block->count--;
+    }
+
+    // Dolu bloğun üst yarısını hemen arkasına eklenen yeni bloğa taşır
+    void split(Block* block) {
+        Block* upper = new Block();
+        size_t half = block->count / 2;
+        T* items = block->items();
+        for (size_t i = half; i < block->count; i++) {
+            new (upper->items() + (i - half)) T(std::move(items[i]));
+            items[i].~T();
+        }
+        upper->count = block->count - half;
+        block->count = half;
+        upper->next = block->next;
+        block->next = upper;
+        if (tail == block) {
+            tail = upper;
+        }
+        blockCount++;
+    }
+
+    void unlink(Block* prev, Block* block) {
+        if (prev == nullptr) {
+            head = block->next;
+        } else {
+            prev->next = block->next;
+        }
+        if (tail == block) {
+            tail = prev;
+        }
+        delete block;
+        blockCount--;
+    }
+
+    // Silme sonrası: boş blok kaldırılır, yarıdan az dolu blok sığıyorsa sonrakiyle birleştirilir
+    void rebalance(Block* prev, Block* block) {
+        if (block->count == 0) {
+            unlink(prev, block);
+            return;
+        }
+        Block* next = block->next;
+        if (block->count < BLOCK_CAPACITY / 2 && next != nullptr && block->count + next->count <= BLOCK_CAPACITY) {
+            T* items = next->items();
+            for (size_t i = 0; i < next->count; i++) {
+                new (block->items() + block->count + i) T(std::move(items[i]));
+                items[i].~T();
+            }
+            block->count += next->count;
+            next->count = 0;
+            unlink(block, next);
+        }
+    }
+
+    static void destroyBlock(Block* block) {
+        T* items = block->items();
+        for (size_t i = 0; i < block->count; i++) {
+            items[i].~T();
+        }
+        delete block;
+    }
+
+public:
+    // Yapıcı fonksiyon
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), size(0), blockCount(0) {}
+
+    // Kopyalama yapıcı fonksiyonu
+    UnrolledLinkedList(const UnrolledLinkedList& other) : head(nullptr), tail(nullptr), size(0), blockCount(0) {
+        concat(other);
+    }
+
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other) {
+        if (this != &other) {
+            clear();
+            concat(other);
+        }
+        return *this;
+    }
+
+    // Yıkıcı fonksiyon
+    ~UnrolledLinkedList() {
+        clear();
+    }
+
+    // Temel operasyonlar
+    bool empty() const {
+        return size == 0;
+    }
+
+    size_t getSize() const {
+        return size;
+    }
+
+    size_t getBlockCount() const {
+        return blockCount;
+    }
+
+    // Başa eleman ekleme
+    void pushFront(const T& value) {
+        T item(value);  // value listedeki bir eleman olabilir
+        if (head == nullptr || head->full()) {
+            Block* block = new Block();
+            block->next = head;
+            head = block;
+            if (tail == nullptr) {
+                tail = block;
+            }
+            blockCount++;
+        }
+        insertAt(head, 0, std::move(item));
+        size++;
+    }
+
+    void pushBack(const T& value) {
+        T item(value);
+        Block* block = (tail == nullptr || tail->full()) ? appendBlock() : tail;
+        insertAt(block, block->count, std::move(item));
+        size++;
+    }
+
+    void insert(size_t index, const T& value) {
+        if (index > size) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (index == size) {
+            pushBack(value);
+            return;
+        }
+        T item(value);  // value listedeki bir eleman olabilir; split ve kaydırmadan önce kopyalanır
+        Position pos = locate(index);
+        if (pos.block->full()) {
+            split(pos.block);
+            if (pos.offset > pos.block->count) {
+                pos.offset -= pos.block->count;
+                pos.block = pos.block->next;
+            }
+        }
+        insertAt(pos.block, pos.offset, std::move(item));
+        size++;
+    }
+
+    void popFront() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        eraseAt(head, 0);
+        size--;
+        rebalance(nullptr, head);
+    }
+
+    void popBack() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        eraseAt(tail, tail->count - 1);
+        size--;
+        if (tail->count == 0) {
+            // Önceki bloğu bulmak için bloklar üzerinde yürünür: O(n / B)
+            Block* prev = nullptr;
+            for (Block* current = head; current != tail; current = current->next) {
+                prev = current;
+            }
+            unlink(prev, tail);
+        }
+    }
+
+    void remove(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        Position pos = locate(index);
+        eraseAt(pos.block, pos.offset);
+        size--;
+        rebalance(pos.prev, pos.block);
+    }
+
+    void removeValue(const T& value) {
+        Block* prev = nullptr;
+        for (Block* current = head; current != nullptr; current = current->next) {
+            T* items = current->items();
+            for (size_t i = 0; i < current->count; i++) {
+                if (items[i] == value) {
+                    eraseAt(current, i);
+                    size--;
+                    rebalance(prev, current);
+                    return;
+                }
+            }
+            prev = current;
+        }
+    }
+
+    // Erişim operasyonları
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head->items()[0];
+    }
+
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head->items()[0];
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail->items()[tail->count - 1];
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail->items()[tail->count - 1];
+    }
+
+    T& at(size_t index) {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        Position pos = locate(index);
+        return pos.block->items()[pos.offset];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size) {
+            throw std::out_of_range("Index out of range");
+        }
+        Position pos = locate(index);
+        return pos.block->items()[pos.offset];
+    }
+
+    // Arama operasyonları
+    size_t find(const T& value) const {
+        size_t base = 0;
+        for (Block* current = head; current != nullptr; current = current->next) {
+            const T* items = current->items();
+            for (size_t i = 0; i < current->count; i++) {
+                if (items[i] == value) {
+                    return base + i;
+                }
+            }
+            base += current->count;
+        }
+        return size;
+    }
+
+    bool contains(const T& value) const {
+        return find(value) != size;
+    }
+
+    // İstatistiksel operasyonlar - iç döngüler bitişik dizi üzerinde
+    T getMax() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T maxVal = head->items()[0];
+        for (Block* current = head; current != nullptr; current = current->next) {
+            const T* items = current->items();
+            for (size_t i = 0; i < current->count; i++) {
+                if (items[i] > maxVal) {
+                    maxVal = items[i];
+                }
+            }
+        }
+        return maxVal;
+    }
+
+    T getMin() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T minVal = head->items()[0];
+        for (Block* current = head; current != nullptr; current = current->next) {
+            const T* items = current->items();
+            for (size_t i = 0; i < current->count; i++) {
+                if (items[i] < minVal) {
+                    minVal = items[i];
+                }
+            }
+        }
+        return minVal;
+    }
+
+    T getSum() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T sum = T();
+        for (Block* current = head; current != nullptr; current = current->next) {
+            const T* items = current->items();
+            for (size_t i = 0; i < current->count; i++) {
+                sum += items[i];
+            }
+        }
+        return sum;
+    }
+
+    double getAverage() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return static_cast<double>(getSum()) / size;
+    }
+
+    // Manipülasyon operasyonları
+    void reverse() {
+        if (size <= 1) return;
+
+        Block* prev = nullptr;
+        Block* current = head;
+        tail = head;
+        while (current != nullptr) {
+            Block* next = current->next;
+            current->next = prev;
+            std::reverse(current->items(), current->items() + current->count);
+            prev = current;
+            current = next;
+        }
+        head = prev;
+    }
+
+    // Kararlı sıralama: elemanlar bir vektöre taşınıp sıralanır ve aynı blok yapısına geri yazılır
+    void sort() {
+        if (size <= 1) return;
+        std::vector<T> values;
+        values.reserve(size);
+        for (Block* current = head; current != nullptr; current = current->next) {
+            T* items = current->items();
+            for (size_t i = 0; i < current->count; i++) {
+                values.push_back(std::move(items[i]));
+            }
+        }
+        std::stable_sort(values.begin(), values.end());
+        size_t k = 0;
+        for (Block* current = head; current != nullptr; current = current->next) {
+            T* items = current->items();
+            for (size_t i = 0; i < current->count; i++) {
+                items[i] = std::move(values[k++]);
+            }
+        }
+    }
+
+    void clear() {
+        Block* current = head;
+        while (current != nullptr) {
+            Block* next = current->next;
+            destroyBlock(current);
+            current = next;
+        }
+        head = tail = nullptr;
+        size = 0;
+        blockCount = 0;
+    }
+
+    // Birleştirme operasyonları
+    void concat(const UnrolledLinkedList& other) {
+        for (Block* current = other.head; current != nullptr; current = current->next) {
+            const T* items = current->items();
+            for (size_t i = 0; i < current->count; i++) {
+                pushBack(items[i]);
+            }
+        }
+    }
+
+    UnrolledLinkedList merge(const UnrolledLinkedList& other) const {
+        UnrolledLinkedList result;
+        Block* b1 = head;
+        Block* b2 = other.head;
+        size_t i1 = 0, i2 = 0;
+
+        while (b1 != nullptr && b2 != nullptr) {
+            const T& v1 = b1->items()[i1];
+            const T& v2 = b2->items()[i2];
+            if (v1 <= v2) {
+                result.pushBack(v1);
+                if (++i1 == b1->count) {
+                    b1 = b1->next;
+                    i1 = 0;
+                }
+            } else {
+                result.pushBack(v2);
+                if (++i2 == b2->count) {
+                    b2 = b2->next;
+                    i2 = 0;
+                }
+            }
+        }
+
+        for (; b1 != nullptr; b1 = b1->next, i1 = 0) {
+            for (; i1 < b1->count; i1++) {
+                result.pushBack(b1->items()[i1]);
+            }
+        }
+        for (; b2 != nullptr; b2 = b2->next, i2 = 0) {
+            for (; i2 < b2->count; i2++) {
+                result.pushBack(b2->items()[i2]);
+            }
+        }
+
+        return result;
+    }
+
+    // Ortadaki eleman (çift uzunlukta LinkedList::findMiddle gibi ikinci orta); boş listede nullptr
+    const T* findMiddle() const {
+        if (empty()) return nullptr;
+        return &at(size / 2);
+    }
+};
+
+#endif // UNROLLED_LIST_H
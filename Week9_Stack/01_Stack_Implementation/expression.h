@@ -0,0 +1,412 @@
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "stack.h"
+
+// Toplu değerlendirmede bir seferde işlenen satır sayısı (her stack slotu bu kadar double tutar)
+constexpr size_t EXPRESSION_BATCH_ROWS = 256;
+
+// İfade derleyicisi: infix ifade bir kez shunting-yard ile postfix bytecode'a çevrilir,
+// sonra ArrayStack üzerinde istenildiği kadar farklı değişken değerleriyle değerlendirilir.
+// Desteklenenler: sayılar, değişkenler, + - * / ^ (sağdan birleşir), tekli -, parantez ve
+// sqrt abs exp log sin cos fonksiyonları. Öncelik: ^ > tekli - > * / > + -
+// evaluate ve evaluateColumns nesnenin çalışma stack'lerini kullanır; thread başına bir kopya kullanılmalıdır.
+class CompiledExpression {
+public:
+    enum class OpCode {
+        PushConstant,
+        PushVariable,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Negate,
+        Sqrt,
+        Abs,
+        Exp,
+        Log,
+        Sin,
+        Cos
+    };
+
+    struct Instruction {
+        OpCode code;
+        int variable;     // PushVariable için değişken indeksi
+        double constant;  // PushConstant için değer
+    };
+
+private:
+    // Derleme sırasında operatör stack'inde tutulan işaretler
+    enum class Pending {
+        LeftParen,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Negate,
+        Sqrt,
+        Abs,
+        Exp,
+        Log,
+        Sin,
+        Cos
+    };
+
+    std::vector<std::string> variables;
+    std::vector<Instruction> code;
+    int maxDepth;
+    ArrayStack<double> values;         // evaluate için
+    ArrayStack<const double*> blocks;  // evaluateColumns için: her eleman bir slotun satır bloğu
+    std::vector<double> workspace;     // maxDepth x EXPRESSION_BATCH_ROWS
+
+    static int precedence(Pending op) {
+        switch (op) {
+            case Pending::Add:
+            case Pending::Subtract: return 1;
+            case Pending::Multiply:
+            case Pending::Divide: return 2;
+            case Pending::Negate: return 3;
+            case Pending::Power: return 4;
+            default: return 0;
+        }
+    }
+
+    static bool isFunction(Pending op) {
+        return op >= Pending::Sqrt;
+    }
+
+    static OpCode toOpCode(Pending op) {
+        switch (op) {
+            case Pending::Add: return OpCode::Add;
+            case Pending::Subtract: return OpCode::Subtract;
+            case Pending::Multiply: return OpCode::Multiply;
+            case Pending::Divide: return OpCode::Divide;
+            case Pending::Power: return OpCode::Power;
+            case Pending::Negate: return OpCode::Negate;
+            case Pending::Sqrt: return OpCode::Sqrt;
+            case Pending::Abs: return OpCode::Abs;
+            case Pending::Exp: return OpCode::Exp;
+            case Pending::Log: return OpCode::Log;
+            case Pending::Sin: return OpCode::Sin;
+            default: return OpCode::Cos;
+        }
+    }
+
+    static bool lookupFunction(const std::string& name, Pending& op) {
+        static const struct {
+            const char* name;
+            Pending op;
+        } functions[] = {{"sqrt", Pending::Sqrt}, {"abs", Pending::Abs}, {"exp", Pending::Exp},
+                         {"log", Pending::Log}, {"sin", Pending::Sin}, {"cos", Pending::Cos}};
+        for (const auto& f : functions) {
+            if (name == f.name) {
+                op = f.op;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Talimatı ekler ve stack derinliğini izler; operand eksikse ifade hatalıdır
+    void emit(const Instruction& instruction, int& depth) {
+        switch (instruction.code) {
+            case OpCode::PushConstant:
+            case OpCode::PushVariable:
+                depth++;
+                break;
+            case OpCode::Add:
+            case OpCode::Subtract:
+            case OpCode::Multiply:
+            case OpCode::Divide:
+            case OpCode::Power:
+                if (depth < 2) {
+                    throw std::invalid_argument("Eksik operand");
+                }
+                depth--;
+                break;
+            default:
+                if (depth < 1) {
+                    throw std::invalid_argument("Eksik operand");
+                }
+                break;
+        }
+        maxDepth = std::max(maxDepth, depth);
+        code.push_back(instruction);
+    }
+
+    void emitPending(Pending op, int& depth) {
+        emit({toOpCode(op), -1, 0.0}, depth);
+    }
+
+    void compile(const std::string& infix) {
+        ArrayStack<Pending> operators(16, true);
+        int depth = 0;
+        bool expectOperand = true;
+        size_t i = 0;
+        while (i < infix.size()) {
+            char c = infix[i];
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                i++;
+            } else if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+                if (!expectOperand) {
+                    throw std::invalid_argument("Beklenmeyen sayı: " + infix.substr(i));
+                }
+                const char* begin = infix.c_str() + i;
+                char* end = nullptr;
+                double value = std::strtod(begin, &end);
+                if (end == begin) {
+                    throw std::invalid_argument("Geçersiz sayı: " + infix.substr(i));
+                }
+                i += static_cast<size_t>(end - begin);
+                emit({OpCode::PushConstant, -1, value}, depth);
+                expectOperand = false;
+            } else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+                if (!expectOperand) {
+                    throw std::invalid_argument("Beklenmeyen isim: " + infix.substr(i));
+                }
+                size_t start = i;
+                while (i < infix.size() && (std::isalnum(static_cast<unsigned char>(infix[i])) || infix[i] == '_')) {
+                    i++;
+                }
+                std::string name = infix.substr(start, i - start);
+                size_t next = i;
+                while (next < infix.size() && std::isspace(static_cast<unsigned char>(infix[next]))) {
+                    next++;
+                }
+                Pending function;
+                if (next < infix.size() && infix[next] == '(' && lookupFunction(name, function)) {
+                    operators.push(function);  // Parantez bir sonraki turda eklenir
+                    continue;
+                }
+                auto it = std::find(variables.begin(), variables.end(), name);
+                if (it == variables.end()) {
+                    throw std::invalid_argument("Bilinmeyen değişken: " + name);
+                }
+                emit({OpCode::PushVariable, static_cast<int>(it - variables.begin()), 0.0}, depth);
+                expectOperand = false;
+            } else if (c == '(') {
+                if (!expectOperand) {
+                    throw std::invalid_argument("Beklenmeyen parantez");
+                }
+                operators.push(Pending::LeftParen);
+                i++;
+            } else if (c == ')') {
+                if (expectOperand) {
+                    throw std::invalid_argument("Eksik operand");
+                }
+                while (!operators.isEmpty() && operators.peek() != Pending::LeftParen) {
+                    emitPending(operators.pop(), depth);
+                }
+                if (operators.isEmpty()) {
+                    throw std::invalid_argument("Parantezler dengesiz");
+                }
+                operators.pop();
+                if (!operators.isEmpty() && isFunction(operators.peek())) {
+                    emitPending(operators.pop(), depth);
+                }
+                i++;
+            } else {
+                Pending op;
+                switch (c) {
+                    case '+': op = Pending::Add; break;
+                    case '-': op = expectOperand ? Pending::Negate : Pending::Subtract; break;
+                    case '*': op = Pending::Multiply; break;
+                    case '/': op = Pending::Divide; break;
+                    case '^': op = Pending::Power; break;
+                    default: throw std::invalid_argument(std::string("Beklenmeyen karakter: ") + c);
+                }
+                i++;
+                if (expectOperand) {
+                    if (op == Pending::Add) {
+                        continue;  // Tekli + etkisizdir
+                    }
+                    if (op != Pending::Negate) {
+                        throw std::invalid_argument("Eksik operand");
+                    }
+                    operators.push(op);  // Tekli operatör önceki operatörleri boşaltmaz
+                    continue;
+                }
+                // Sağdan birleşen ^ yalnızca kesin daha yüksek önceliği, diğerleri eşitini de boşaltır
+                bool rightAssociative = (op == Pending::Power);
+                while (!operators.isEmpty() && operators.peek() != Pending::LeftParen &&
+                       !isFunction(operators.peek()) &&
+                       (precedence(operators.peek()) > precedence(op) ||
+                        (!rightAssociative && precedence(operators.peek()) == precedence(op)))) {
+                    emitPending(operators.pop(), depth);
+                }
+                operators.push(op);
+                expectOperand = true;
+            }
+        }
+        if (expectOperand) {
+            throw std::invalid_argument("Eksik operand");
+        }
+        while (!operators.isEmpty()) {
+            Pending op = operators.pop();
+            if (op == Pending::LeftParen || isFunction(op)) {
+                throw std::invalid_argument("Parantezler dengesiz");
+            }
+            emitPending(op, depth);
+        }
+        if (depth != 1) {
+            throw std::invalid_argument("Geçersiz ifade");
+        }
+    }
+
+    static double applyUnary(OpCode code, double a) {
+        switch (code) {
+            case OpCode::Negate: return -a;
+            case OpCode::Sqrt: return std::sqrt(a);
+            case OpCode::Abs: return std::fabs(a);
+            case OpCode::Exp: return std::exp(a);
+            case OpCode::Log: return std::log(a);
+            case OpCode::Sin: return std::sin(a);
+            default: return std::cos(a);
+        }
+    }
+
+    // Blok üzerinde tek bir işlem; döngüler derleyicinin vektörleştirebileceği düz dizi döngüleridir
+    static void applyBlock(OpCode code, double* dst, const double* a, const double* b, size_t n) {
+        switch (code) {
+            case OpCode::Add: for (size_t r = 0; r < n; r++) dst[r] = a[r] + b[r]; break;
+            case OpCode::Subtract: for (size_t r = 0; r < n; r++) dst[r] = a[r] - b[r]; break;
+            case OpCode::Multiply: for (size_t r = 0; r < n; r++) dst[r] = a[r] * b[r]; break;
+            case OpCode::Divide: for (size_t r = 0; r < n; r++) dst[r] = a[r] / b[r]; break;
+            case OpCode::Power: for (size_t r = 0; r < n; r++) dst[r] = std::pow(a[r], b[r]); break;
+            case OpCode::Negate: for (size_t r = 0; r < n; r++) dst[r] = -a[r]; break;
+            default: for (size_t r = 0; r < n; r++) dst[r] = applyUnary(code, a[r]); break;
+        }
+    }
+
+public:
+    // Constructor: infix ifadeyi derler; names[i] değerlendirmede values[i] / columns[i] ile eşleşir
+    CompiledExpression(const std::string& infix, const std::vector<std::string>& names)
+        : variables(names), maxDepth(0), values(1), blocks(1) {
+        compile(infix);
+        values = ArrayStack<double>(maxDepth);
+        blocks = ArrayStack<const double*>(maxDepth);
+        workspace.assign(static_cast<size_t>(maxDepth) * EXPRESSION_BATCH_ROWS, 0.0);
+    }
+
+    // Tek satır: values[i] i'nci değişkenin değeri. Derinlik derlemede doğrulandığından push taşmaz.
+    double evaluate(const double* variableValues) {
+        values.clear();
+        for (const Instruction& instruction : code) {
+            switch (instruction.code) {
+                case OpCode::PushConstant:
+                    values.push(instruction.constant);
+                    break;
+                case OpCode::PushVariable:
+                    values.push(variableValues[instruction.variable]);
+                    break;
+                case OpCode::Add: { double b = values.pop(); values.push(values.pop() + b); break; }
+                case OpCode::Subtract: { double b = values.pop(); values.push(values.pop() - b); break; }
+                case OpCode::Multiply: { double b = values.pop(); values.push(values.pop() * b); break; }
+                case OpCode::Divide: { double b = values.pop(); values.push(values.pop() / b); break; }
+                case OpCode::Power: { double b = values.pop(); values.push(std::pow(values.pop(), b)); break; }
+                default:
+                    values.push(applyUnary(instruction.code, values.pop()));
+                    break;
+            }
+        }
+        return values.pop();
+    }
+
+    double evaluate(const std::vector<double>& variableValues) {
+        if (variableValues.size() != variables.size()) {
+            throw std::invalid_argument("Değişken sayısı uyuşmuyor");
+        }
+        return evaluate(variableValues.data());
+    }
+
+    // Toplu (sütunlu) değerlendirme: columns[i][r], r'inci satırda i'nci değişkenin değeri.
+    // Satırlar EXPRESSION_BATCH_ROWS'luk bloklar halinde işlenir; her talimat tüm bloğa uygulanır,
+    // böylece talimat başına dağıtım maliyeti satır sayısına bölünür ve iç döngüler vektörleşir.
+    void evaluateColumns(const std::vector<const double*>& columns, size_t rows, double* out) {
+        if (columns.size() != variables.size()) {
+            throw std::invalid_argument("Değişken sayısı uyuşmuyor");
+        }
+        for (size_t first = 0; first < rows; first += EXPRESSION_BATCH_ROWS) {
+            size_t n = std::min(EXPRESSION_BATCH_ROWS, rows - first);
+            blocks.clear();
+            for (const Instruction& instruction : code) {
+                // Sonuç her zaman talimattan sonraki en üst slotun çalışma alanına yazılır
+                switch (instruction.code) {
+                    case OpCode::PushConstant: {
+                        double* slot = workspace.data() + blocks.size() * EXPRESSION_BATCH_ROWS;
+                        std::fill(slot, slot + n, instruction.constant);
+                        blocks.push(slot);
+                        break;
+                    }
+                    case OpCode::PushVariable: {
+                        // Girdi sütunu kopyalanmaz; bloğa doğrudan işaret edilir
+                        blocks.push(columns[instruction.variable] + first);
+                        break;
+                    }
+                    case OpCode::Add:
+                    case OpCode::Subtract:
+                    case OpCode::Multiply:
+                    case OpCode::Divide:
+                    case OpCode::Power: {
+                        const double* b = blocks.pop();
+                        const double* a = blocks.pop();
+                        double* slot = workspace.data() + blocks.size() * EXPRESSION_BATCH_ROWS;
+                        applyBlock(instruction.code, slot, a, b, n);
+                        blocks.push(slot);
+                        break;
+                    }
+                    default: {
+                        const double* a = blocks.pop();
+                        double* slot = workspace.data() + blocks.size() * EXPRESSION_BATCH_ROWS;
+                        applyBlock(instruction.code, slot, a, nullptr, n);
+                        blocks.push(slot);
+                        break;
+                    }
+                }
+            }
+            const double* result = blocks.pop();
+            std::copy(result, result + n, out + first);
+        }
+    }
+
+    // Derlenmiş bytecode'un okunabilir postfix gösterimi
+    std::string toPostfix() const {
+        static const char* names[] = {"", "", "+", "-", "*", "/", "^", "neg", "sqrt", "abs", "exp", "log", "sin", "cos"};
+        std::string result;
+        for (const Instruction& instruction : code) {
+            if (!result.empty()) {
+                result += ' ';
+            }
+            if (instruction.code == OpCode::PushConstant) {
+                std::ostringstream number;
+                number << instruction.constant;
+                result += number.str();
+            } else if (instruction.code == OpCode::PushVariable) {
+                result += variables[instruction.variable];
+            } else {
+                result += names[static_cast<int>(instruction.code)];
+            }
+        }
+        return result;
+    }
+
+    const std::vector<Instruction>& getCode() const {
+        return code;
+    }
+
+    int getMaxDepth() const {
+        return maxDepth;
+    }
+};
+
+#endif // EXPRESSION_H
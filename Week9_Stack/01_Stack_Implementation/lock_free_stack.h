@@ -0,0 +1,360 @@
+#ifndef LOCK_FREE_STACK_H
+#define LOCK_FREE_STACK_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Aynı anda hazard pointer kullanabilecek en fazla thread sayısı
+constexpr size_t HAZARD_MAX_THREADS = 128;
+// Thread'in silinmeyi bekleyen düğüm listesi bu boyuta ulaşınca taranır (tarama maliyeti amortize olur)
+constexpr size_t HAZARD_RETIRE_THRESHOLD = 2 * HAZARD_MAX_THREADS;
+
+// Hazard pointer'lar: bir thread okuyacağı düğümü önce kendi slotuna yazar, sonra düğümün hâlâ
+// erişilebilir olduğunu doğrular. Çıkarılan düğümler hemen silinmez (retire); hiçbir slotta
+// görünmedikleri bir taramada silinir. Böylece başka bir thread'in okumakta olduğu düğüm
+// serbest bırakılmaz ve aynı adres yeniden kullanılamadığı için ABA oluşmaz.
+class HazardPointers {
+private:
+    // Thread başına tek slot; false sharing olmasın diye cache line hizalı
+    struct alignas(64) Slot {
+        std::atomic<bool> used{false};
+        std::atomic<const void*> pointer{nullptr};
+    };
+
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+    };
+
+    // Çıkan thread'lerden kalan, hâlâ korunan düğümler; program sonunda silinir
+    struct Orphans {
+        std::mutex mutex;
+        std::vector<Retired> list;
+        ~Orphans() {
+            for (const Retired& r : list) {
+                r.deleter(r.pointer);
+            }
+        }
+    };
+
+    struct ThreadRecord {
+        Slot* slot = nullptr;
+        std::vector<Retired> retired;
+
+        ~ThreadRecord() {
+            if (slot == nullptr) return;
+            slot->pointer.store(nullptr);
+            scan(retired);
+            if (!retired.empty()) {
+                Orphans& orphans = orphanList();
+                std::lock_guard<std::mutex> lock(orphans.mutex);
+                orphans.list.insert(orphans.list.end(), retired.begin(), retired.end());
+            }
+            slot->used.store(false);
+        }
+    };
+
+    static Slot* slots() {
+        static Slot table[HAZARD_MAX_THREADS];
+        return table;
+    }
+
+    static Orphans& orphanList() {
+        static Orphans orphans;
+        return orphans;
+    }
+
+    static ThreadRecord& local() {
+        thread_local ThreadRecord record;
+        if (record.slot == nullptr) {
+            Slot* table = slots();
+            orphanList();  // Thread kayıtlarından önce kurulsun, sonra yok edilsin
+            for (size_t i = 0; i < HAZARD_MAX_THREADS; i++) {
+                bool expected = false;
+                if (!table[i].used.load() && table[i].used.compare_exchange_strong(expected, true)) {
+                    record.slot = &table[i];
+                    break;
+                }
+            }
+            if (record.slot == nullptr) {
+                throw std::runtime_error("Hazard pointer slotu kalmadı");
+            }
+        }
+        return record;
+    }
+
+    // Hiçbir slotta görünmeyen düğümleri siler, korunanları listede bırakır
+    static void scan(std::vector<Retired>& retired) {
+        Orphans& orphans = orphanList();
+        if (orphans.mutex.try_lock()) {
+            retired.insert(retired.end(), orphans.list.begin(), orphans.list.end());
+            orphans.list.clear();
+            orphans.mutex.unlock();
+        }
+
+        std::vector<const void*> hazards;
+        hazards.reserve(HAZARD_MAX_THREADS);
+        Slot* table = slots();
+        for (size_t i = 0; i < HAZARD_MAX_THREADS; i++) {
+            const void* p = table[i].pointer.load();
+            if (p != nullptr) {
+                hazards.push_back(p);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        size_t kept = 0;
+        for (const Retired& r : retired) {
+            if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(r.pointer))) {
+                retired[kept++] = r;
+            } else {
+                r.deleter(r.pointer);
+            }
+        }
+        retired.resize(kept);
+    }
+
+public:
+    // p'yi bu thread için korur; çağıran p'nin hâlâ erişilebilir olduğunu sonra doğrulamalıdır
+    static void protect(const void* p) {
+        local().slot->pointer.store(p);
+    }
+
+    static void clear() {
+        local().slot->pointer.store(nullptr);
+    }
+
+    // Kapsamdan çıkarken (istisna dahil) korumayı kaldırır; protect'ten sonra kurulmalıdır
+    struct ClearGuard {
+        ClearGuard() = default;
+        ClearGuard(const ClearGuard&) = delete;
+        ClearGuard& operator=(const ClearGuard&) = delete;
+        ~ClearGuard() { clear(); }
+    };
+
+    // Artık erişilemeyen düğümü güvenli olduğunda silinmek üzere kaydeder
+    template <typename Node>
+    static void retire(Node* node) {
+        ThreadRecord& record = local();
+        record.retired.push_back({node, [](void* p) { delete static_cast<Node*>(p); }});
+        if (record.retired.size() >= HAZARD_RETIRE_THRESHOLD) {
+            scan(record.retired);
+        }
+    }
+};
+
+// Eleme (elimination) dizisinin slot sayısı ve bir push teklifinin beklediği tur sayısı
+constexpr size_t ELIMINATION_SLOTS = 16;
+constexpr int ELIMINATION_SPINS = 128;
+
+// Lock-free stack (Treiber): top tek bir atomic pointer, push/pop compare-and-swap ile yapılır.
+// Bellek güvenliği ve ABA için pop hazard pointer kullanır (bkz. HazardPointers).
+// Yoğun çekişmede elimination açılabilir: CAS'ı başarısız olan push ve pop, rastgele bir slotta
+// buluşup elemanı stack'e hiç dokunmadan birbirine verir.
+// LinkedStack ile aynı push/pop/peek semantiği; eşzamanlı kullanımda isEmpty() ardından pop()
+// yarışabileceği için tryPop tercih edilmelidir.
+template<typename T>
+class LockFreeStack {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        explicit Node(const T& value) : data(value), next(nullptr) {}
+    };
+
+    // Eleme slotu: nullptr boş, taken() alındı, diğer değerler push'un teklif ettiği düğüm
+    struct alignas(64) Exchanger {
+        std::atomic<Node*> offer{nullptr};
+    };
+
+    std::atomic<Node*> top;
+    std::atomic<int> count;
+    bool elimination;
+    Exchanger exchangers[ELIMINATION_SLOTS];
+
+    static Node* taken() {
+        static char marker;
+        return reinterpret_cast<Node*>(&marker);
+    }
+
+    static Exchanger& randomExchanger(Exchanger* exchangers) {
+        thread_local uint32_t state = 0x9E3779B9u ^ static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&state));
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return exchangers[state % ELIMINATION_SLOTS];
+    }
+
+    // Düğümü bir slotta teklif eder; bir pop alırsa true
+    bool eliminatePush(Node* node) {
+        Exchanger& exchanger = randomExchanger(exchangers);
+        Node* expected = nullptr;
+        if (!exchanger.offer.compare_exchange_strong(expected, node)) {
+            return false;
+        }
+        for (int i = 0; i < ELIMINATION_SPINS; i++) {
+            if (exchanger.offer.load() == taken()) {
+                exchanger.offer.store(nullptr);
+                return true;
+            }
+        }
+        expected = node;
+        if (exchanger.offer.compare_exchange_strong(expected, nullptr)) {
+            return false;  // Teklif geri çekildi
+        }
+        exchanger.offer.store(nullptr);  // Geri çekilirken alındı
+        return true;
+    }
+
+    // Bekleyen bir teklifi alır; düğüm artık yalnızca bu thread'indir (stack'e hiç girmedi)
+    Node* eliminatePop() {
+        Exchanger& exchanger = randomExchanger(exchangers);
+        Node* offered = exchanger.offer.load();
+        if (offered == nullptr || offered == taken()) {
+            return nullptr;
+        }
+        if (exchanger.offer.compare_exchange_strong(offered, taken())) {
+            return offered;
+        }
+        return nullptr;
+    }
+
+    // Üstteki düğümü çıkarır; boşsa nullptr. Dönen düğüm hazard korumalı değildir,
+    // stack'ten geldiyse retire, elemeden geldiyse doğrudan delete edilmelidir.
+    Node* popNode(bool& fromStack) {
+        for (;;) {
+            Node* old = top.load();
+            if (old == nullptr) {
+                HazardPointers::clear();
+                return nullptr;
+            }
+            HazardPointers::protect(old);
+            if (top.load() != old) {
+                continue;  // Koruma yazılmadan önce çıkarılmış olabilir
+            }
+            if (top.compare_exchange_weak(old, old->next)) {
+                HazardPointers::clear();
+                count.fetch_sub(1, std::memory_order_relaxed);
+                fromStack = true;
+                return old;
+            }
+            if (elimination) {
+                HazardPointers::clear();
+                if (Node* node = eliminatePop()) {
+                    fromStack = false;
+                    return node;
+                }
+            }
+        }
+    }
+
+    static void dispose(Node* node, bool fromStack) {
+        if (fromStack) {
+            HazardPointers::retire(node);
+        } else {
+            delete node;
+        }
+    }
+
+    // Stack'ten çıkan düğüm hâlâ peek yapan thread'lerce okunuyor olabilir (hazard yalnızca silinmeyi
+    // engeller): veri kopyalanır, yayımlanmış bir düğüm hiçbir zaman değiştirilmez.
+    // Elemeden gelen düğüm hiç görünür olmadığından taşınabilir.
+    static T take(Node* node, bool fromStack) {
+        T value = fromStack ? T(node->data) : T(std::move(node->data));
+        dispose(node, fromStack);
+        return value;
+    }
+
+public:
+    // Constructor: elimination yoğun çekişmede CAS yarışlarını azaltır
+    explicit LockFreeStack(bool useElimination = false) : top(nullptr), count(0), elimination(useElimination) {}
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    // Destructor: başka thread erişmiyor olmalı
+    ~LockFreeStack() {
+        Node* current = top.load();
+        while (current != nullptr) {
+            Node* next = current->next;
+            delete current;
+            current = next;
+        }
+    }
+
+    // Stack'e eleman ekler
+    void push(const T& value) {
+        Node* node = new Node(value);
+        node->next = top.load(std::memory_order_relaxed);
+        while (!top.compare_exchange_weak(node->next, node)) {
+            if (elimination && eliminatePush(node)) {
+                return;
+            }
+        }
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Stack'ten eleman çıkarır ve döndürür
+    T pop() {
+        bool fromStack;
+        Node* node = popNode(fromStack);
+        if (node == nullptr) {
+            throw std::underflow_error("Stack boş");
+        }
+        return take(node, fromStack);
+    }
+
+    // İstisnasız pop: boşsa false
+    bool tryPop(T& value) {
+        bool fromStack;
+        Node* node = popNode(fromStack);
+        if (node == nullptr) {
+            return false;
+        }
+        value = take(node, fromStack);
+        return true;
+    }
+
+    // Stack'in en üstündeki elemanı döndürür (kopya; düğüm okunurken hazard ile korunur).
+    // Eşzamanlı pop ile güvenlidir: pop da düğümdeki veriyi yalnızca okur.
+    // T'nin kopyası istisna fırlatsa da koruma kaldırılır, aksi halde düğüm hiç silinemezdi.
+    T peek() const {
+        for (;;) {
+            Node* current = top.load();
+            if (current == nullptr) {
+                throw std::underflow_error("Stack boş");
+            }
+            HazardPointers::protect(current);
+            HazardPointers::ClearGuard guard;
+            if (top.load() == current) {
+                return current->data;
+            }
+        }
+    }
+
+    // Stack'in boş olup olmadığını kontrol eder
+    bool isEmpty() const {
+        return top.load() == nullptr;
+    }
+
+    // Stack'teki eleman sayısını döndürür (eşzamanlı değişiklik sırasında yaklaşık)
+    int size() const {
+        return std::max(count.load(std::memory_order_relaxed), 0);
+    }
+
+    // Stack'i temizler
+    void clear() {
+        bool fromStack;
+        while (Node* node = popNode(fromStack)) {
+            dispose(node, fromStack);
+        }
+    }
+};
+
+#endif // LOCK_FREE_STACK_H
@@ -0,0 +1,404 @@
+#ifndef SEGMENTED_STACK_H
+#define SEGMENTED_STACK_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#endif
+
+// Bir chunk'ın hedef boyutu (başlık dahil)
+constexpr size_t SEGMENTED_STACK_CHUNK_BYTES = 64 * 1024;
+
+// Segmentli stack: sabit boyutlu chunk'ların bağlı listesi.
+// ArrayStack gibi büyürken kopyalamaz, LinkedStack gibi eleman başına bellek ayırmaz.
+// Boşalan chunk hemen bırakılmaz, bir sonraki büyüme için saklanır (tek chunk'lık histerezis);
+// böylece chunk sınırında gidip gelen push/pop her seferinde new/delete yapmaz.
+// İsteğe bağlı olarak bellekte en fazla maxResidentChunks chunk tutulur; en alttaki soğuk chunk'lar
+// geçici bir dosyaya yazılır ve pop onlara inince geri okunur (yalnızca trivially copyable tipler).
+template<typename T>
+class SegmentedStack {
+public:
+    static constexpr int CHUNK_CAPACITY =
+        (SEGMENTED_STACK_CHUNK_BYTES - 2 * sizeof(void*)) / sizeof(T) > 0
+            ? static_cast<int>((SEGMENTED_STACK_CHUNK_BYTES - 2 * sizeof(void*)) / sizeof(T))
+            : 1;
+
+private:
+    struct Chunk {
+        Chunk* below;    // Bir alttaki (daha eski) chunk
+        Chunk* above;    // Bir üstteki chunk
+        alignas(T) unsigned char storage[CHUNK_CAPACITY * sizeof(T)];
+
+        Chunk() : below(nullptr), above(nullptr) {}
+
+        T* items() { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* items() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+    Chunk* top;                // En üstteki chunk (kısmen dolu olabilir), boş stack'te nullptr
+    Chunk* bottom;             // Bellekteki en alt chunk
+    Chunk* spare;              // Histerezis için saklanan boş chunk
+    int topCount;              // top chunk'taki eleman sayısı
+    size_t residentChunks;     // Bellekteki chunk sayısı
+    size_t spilledChunks;      // Dosyaya yazılmış chunk sayısı
+    size_t maxResidentChunks;  // 0: dosyaya yazma kapalı
+    std::FILE* spillFile;
+
+    Chunk* takeChunk() {
+        if (spare != nullptr) {
+            Chunk* chunk = spare;
+            spare = nullptr;
+            return chunk;
+        }
+        return new Chunk();
+    }
+
+    // Boşalan chunk'ı yedek olarak sakla; zaten bir yedek varsa bırak
+    void recycleChunk(Chunk* chunk) {
+        if (spare == nullptr) {
+            spare = chunk;
+        } else {
+            delete chunk;
+        }
+    }
+
+    static void destroyItems(Chunk* chunk, int count) {
+        if (!std::is_trivially_destructible<T>::value) {
+            T* items = chunk->items();
+            for (int i = 0; i < count; i++) {
+                items[i].~T();
+            }
+        }
+    }
+
+    // top doluysa üstüne yeni chunk ekler
+    void ensureRoom() {
+        if (top != nullptr && topCount < CHUNK_CAPACITY) {
+            return;
+        }
+        Chunk* chunk = takeChunk();
+        chunk->below = top;
+        chunk->above = nullptr;
+        if (top != nullptr) {
+            top->above = chunk;
+        } else {
+            bottom = chunk;
+        }
+        top = chunk;
+        topCount = 0;
+        residentChunks++;
+        if (maxResidentChunks != 0 && residentChunks > maxResidentChunks) {
+            spillBottom();
+        }
+    }
+
+    // top boşaldıysa bir alttaki chunk'a iner; bellekte chunk kalmadıysa dosyadan okur
+    void retreat() {
+        if (topCount > 0) {
+            return;
+        }
+        Chunk* empty = top;
+        top = top->below;
+        if (top != nullptr) {
+            top->above = nullptr;
+        } else {
+            bottom = nullptr;
+        }
+        residentChunks--;
+        recycleChunk(empty);
+        if (top == nullptr && spilledChunks > 0) {
+            reloadChunk();
+        }
+        topCount = (top != nullptr) ? CHUNK_CAPACITY : 0;
+    }
+
+    std::FILE* spillStream() {
+        if (spillFile == nullptr) {
+            spillFile = std::tmpfile();
+            if (spillFile == nullptr) {
+                throw std::runtime_error("Spill dosyası açılamadı");
+            }
+        }
+        return spillFile;
+    }
+
+    // Dosyada index. chunk'ın başına konumlanır. Ofset 2 GB'ı aşabilir: long 32-bit olabildiğinden
+    // POSIX'te fseeko/off_t, Windows'ta _fseeki64 kullanılır; ofset tipe sığmıyorsa false döner.
+    static bool seekChunk(std::FILE* file, size_t index) {
+#if defined(__unix__) || defined(__APPLE__)
+        using Offset = off_t;
+#elif defined(_WIN32)
+        using Offset = __int64;
+#else
+        using Offset = long;
+#endif
+        constexpr uintmax_t chunkBytes = sizeof(Chunk::storage);
+        if (index > static_cast<uintmax_t>(std::numeric_limits<Offset>::max()) / chunkBytes) {
+            return false;
+        }
+        Offset offset = static_cast<Offset>(index) * static_cast<Offset>(chunkBytes);
+#if defined(__unix__) || defined(__APPLE__)
+        return fseeko(file, offset, SEEK_SET) == 0;
+#elif defined(_WIN32)
+        return _fseeki64(file, offset, SEEK_SET) == 0;
+#else
+        return std::fseek(file, offset, SEEK_SET) == 0;
+#endif
+    }
+
+    // En alttaki (dolu) chunk'ı dosyanın sonuna yazar ve belleği bırakır
+    void spillBottom() {
+        std::FILE* file = spillStream();
+        Chunk* chunk = bottom;
+        if (!seekChunk(file, spilledChunks) ||
+            std::fwrite(chunk->storage, sizeof(chunk->storage), 1, file) != 1) {
+            throw std::runtime_error("Spill dosyasına yazılamadı");
+        }
+        bottom = chunk->above;
+        bottom->below = nullptr;
+        residentChunks--;
+        spilledChunks++;
+        delete chunk;  // Soğuk chunk yedek olarak saklanmaz
+    }
+
+    // Dosyadaki son chunk'ı okuyup bellekteki tek (dolu) chunk yapar
+    void reloadChunk() {
+        Chunk* chunk = takeChunk();
+        std::FILE* file = spillStream();
+        if (!seekChunk(file, spilledChunks - 1) ||
+            std::fread(chunk->storage, sizeof(chunk->storage), 1, file) != 1) {
+            recycleChunk(chunk);
+            throw std::runtime_error("Spill dosyasından okunamadı");
+        }
+        spilledChunks--;
+        chunk->below = chunk->above = nullptr;
+        top = bottom = chunk;
+        topCount = CHUNK_CAPACITY;
+        residentChunks = 1;
+    }
+
+    void releaseAll() {
+        clear();
+        delete spare;
+        spare = nullptr;
+        if (spillFile != nullptr) {
+            std::fclose(spillFile);
+            spillFile = nullptr;
+        }
+    }
+
+    // other'ın chunk'larını ve dosyasını devralır; other boş kalır (bu nesne önceden boşaltılmış olmalı)
+    void takeFrom(SegmentedStack& other) noexcept {
+        top = other.top;
+        bottom = other.bottom;
+        spare = other.spare;
+        topCount = other.topCount;
+        residentChunks = other.residentChunks;
+        spilledChunks = other.spilledChunks;
+        maxResidentChunks = other.maxResidentChunks;
+        spillFile = other.spillFile;
+        other.top = other.bottom = other.spare = nullptr;
+        other.topCount = 0;
+        other.residentChunks = other.spilledChunks = 0;
+        other.spillFile = nullptr;
+    }
+
+public:
+    // Constructor: maxResident > 0 ise bellekte en fazla o kadar chunk tutulur (en az 2), fazlası dosyaya yazılır
+    explicit SegmentedStack(size_t maxResident = 0)
+        : top(nullptr), bottom(nullptr), spare(nullptr), topCount(0), residentChunks(0), spilledChunks(0),
+          maxResidentChunks(maxResident), spillFile(nullptr) {
+        if (maxResident == 1) {
+            throw std::invalid_argument("Bellekte en az 2 chunk tutulmalıdır");
+        }
+        if (maxResident != 0 && !std::is_trivially_copyable<T>::value) {
+            throw std::invalid_argument("Dosyaya yazma yalnızca trivially copyable tipler için desteklenir");
+        }
+    }
+
+    // Kopyalama desteklenmez (dosyaya yazılmış chunk'lar paylaşılamaz)
+    SegmentedStack(const SegmentedStack&) = delete;
+    SegmentedStack& operator=(const SegmentedStack&) = delete;
+
+    // Move constructor
+    SegmentedStack(SegmentedStack&& other) noexcept
+        : top(nullptr), bottom(nullptr), spare(nullptr), topCount(0), residentChunks(0), spilledChunks(0),
+          maxResidentChunks(0), spillFile(nullptr) {
+        takeFrom(other);
+    }
+
+    // Move assignment: mevcut chunk'lar ve spill dosyası bırakılır
+    SegmentedStack& operator=(SegmentedStack&& other) noexcept {
+        if (this != &other) {
+            releaseAll();
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    // Destructor
+    ~SegmentedStack() {
+        releaseAll();
+    }
+
+    // Stack'e eleman ekler
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    // Elemanı yerinde kurar ve referansını döndürür
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        if (top == nullptr || topCount == CHUNK_CAPACITY) {
+            // Argümanlar stack'teki bir elemana referans olabilir: chunk değişmeden önce kurulur
+            T value(std::forward<Args>(args)...);
+            ensureRoom();
+            T* slot = new (top->items() + topCount) T(std::move(value));
+            ++topCount;
+            return *slot;
+        }
+        T* slot = new (top->items() + topCount) T(std::forward<Args>(args)...);
+        ++topCount;
+        return *slot;
+    }
+
+    // İstisnasız push (ArrayStack ile aynı API); segmentli stack dolmaz
+    bool tryPush(const T& value) {
+        emplace(value);
+        return true;
+    }
+
+    bool tryPush(T&& value) {
+        emplace(std::move(value));
+        return true;
+    }
+
+    // Stack'ten eleman çıkarır ve döndürür (eleman taşınır)
+    T pop() {
+        if (isEmpty()) {
+            throw std::underflow_error("Stack boş");
+        }
+        T* item = top->items() + (topCount - 1);
+        T value = std::move(*item);
+        item->~T();
+        --topCount;
+        retreat();
+        return value;
+    }
+
+    // İstisnasız pop: boşsa false
+    bool tryPop(T& value) {
+        if (isEmpty()) {
+            return false;
+        }
+        T* item = top->items() + (topCount - 1);
+        value = std::move(*item);
+        item->~T();
+        --topCount;
+        retreat();
+        return true;
+    }
+
+    // values[0..count) sırayla push edilir (values[count - 1] en üstte); chunk başına tek blok kopyası
+    void pushMany(const T* values, int count) {
+        if (count < 0) {
+            throw std::invalid_argument("Eleman sayısı negatif olamaz");
+        }
+        while (count > 0) {
+            ensureRoom();
+            int n = std::min(count, CHUNK_CAPACITY - topCount);
+            std::uninitialized_copy(values, values + n, top->items() + topCount);
+            topCount += n;
+            values += n;
+            count -= n;
+        }
+    }
+
+    // Üstteki count elemanı out[0..count) aralığına stack sırasıyla taşır (out[count - 1] eski top).
+    // Yeterli eleman yoksa hiçbiri çıkmaz.
+    void popMany(T* out, int count) {
+        if (count < 0) {
+            throw std::invalid_argument("Eleman sayısı negatif olamaz");
+        }
+        if (static_cast<size_t>(count) > size()) {
+            throw std::underflow_error("Stack boş");
+        }
+        while (count > 0) {
+            int n = std::min(count, topCount);
+            T* first = top->items() + (topCount - n);
+            std::move(first, first + n, out + (count - n));
+            if (!std::is_trivially_destructible<T>::value) {
+                for (int i = 0; i < n; i++) {
+                    first[i].~T();
+                }
+            }
+            topCount -= n;
+            count -= n;
+            retreat();
+        }
+    }
+
+    // Stack'in en üstündeki elemanı döndürür
+    T peek() const {
+        if (isEmpty()) {
+            throw std::underflow_error("Stack boş");
+        }
+        return top->items()[topCount - 1];
+    }
+
+    // Stack'in boş olup olmadığını kontrol eder
+    bool isEmpty() const {
+        return top == nullptr;
+    }
+
+    // ArrayStack ile aynı API; segmentli stack hiçbir zaman dolu değildir
+    bool isFull() const {
+        return false;
+    }
+
+    // Stack'teki eleman sayısını döndürür (100M+ eleman için size_t)
+    size_t size() const {
+        if (top == nullptr) {
+            return 0;
+        }
+        return (spilledChunks + residentChunks - 1) * CHUNK_CAPACITY + static_cast<size_t>(topCount);
+    }
+
+    size_t getResidentChunks() const {
+        return residentChunks;
+    }
+
+    size_t getSpilledChunks() const {
+        return spilledChunks;
+    }
+
+    // Stack'i temizler; yedek chunk ve dosya sonraki kullanım için tutulur
+    void clear() {
+        while (top != nullptr) {
+            Chunk* below = top->below;
+            destroyItems(top, topCount);
+            recycleChunk(top);
+            top = below;
+            topCount = CHUNK_CAPACITY;
+        }
+        bottom = nullptr;
+        topCount = 0;
+        residentChunks = 0;
+        spilledChunks = 0;  // Dosyadaki chunk'lar trivially copyable: yıkıcı gerekmez
+    }
+};
+
+#endif // SEGMENTED_STACK_H
@@ -1,62 +1,236 @@
 #ifndef STACK_H
 #define STACK_H
 
+#include <climits>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 
-// Array tabanlı stack implementasyonu
+// Array tabanlı stack implementasyonu.
+// Elemanlar ham bellekte [0, topIndex] aralığında yaşar (emplace yerinde kurar).
+// growable modunda dolu stack'e push kapasiteyi ikiye katlar, aksi halde overflow_error fırlatır.
 template<typename T>
 class ArrayStack {
 private:
     T* elements;           // Stack elemanlarını tutan array
     int capacity;          // Maximum kapasite
     int topIndex;          // Top elemanın indeksi
+    bool growable;         // Doluyken büyüsün mü
+    
+    static T* allocate(int cap) {
+        return cap > 0 ? std::allocator<T>().allocate(static_cast<size_t>(cap)) : nullptr;
+    }
+    
+    static void deallocate(T* data, int cap) {
+        if (data != nullptr) {
+            std::allocator<T>().deallocate(data, static_cast<size_t>(cap));
+        }
+    }
+    
+    void destroyElements() {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (int i = 0; i <= topIndex; i++) {
+                elements[i].~T();
+            }
+        }
+        topIndex = -1;
+    }
+    
+    // Kapasiteyi newCapacity'ye çıkarır; elemanlar yeni diziye taşınır
+    void reallocate(int newCapacity) {
+        T* data = allocate(newCapacity);
+        int count = topIndex + 1;
+        try {
+            std::uninitialized_copy(std::make_move_iterator(elements), std::make_move_iterator(elements + count), data);
+        } catch (...) {
+            deallocate(data, newCapacity);
+            throw;
+        }
+        destroyElements();
+        deallocate(elements, capacity);
+        elements = data;
+        capacity = newCapacity;
+        topIndex = count - 1;
+    }
+    
+    // extra eleman için yer açar; yer yoksa ve büyüyemiyorsa (veya toplam int'e sığmıyorsa) false
+    bool makeRoom(int extra) {
+        if (extra > INT_MAX - topIndex - 1) {
+            return false;
+        }
+        int needed = topIndex + 1 + extra;
+        if (needed <= capacity) {
+            return true;
+        }
+        if (!growable) {
+            return false;
+        }
+        int newCapacity = capacity > 0 ? capacity : 1;
+        while (newCapacity < needed) {
+            newCapacity = newCapacity > INT_MAX / 2 ? INT_MAX : newCapacity * 2;
+        }
+        reallocate(newCapacity);
+        return true;
+    }
+    
+    // Yavaş yol: kapasiteyi büyütüp önceden kurulmuş elemanı ekler
+    T& growAndPush(T&& value) {
+        if (!makeRoom(1)) {
+            throw std::overflow_error("Stack dolu");
+        }
+        T* slot = new (elements + topIndex + 1) T(std::move(value));
+        ++topIndex;
+        return *slot;
+    }
+    
+    // tryPush gövdesi (const T& ve T&& için ortak)
+    template<typename U>
+    bool tryPushImpl(U&& value) {
+        if (topIndex + 1 == capacity) {
+            if (!growable || capacity == INT_MAX) {
+                return false;
+            }
+            growAndPush(T(std::forward<U>(value)));
+            return true;
+        }
+        new (elements + topIndex + 1) T(std::forward<U>(value));
+        ++topIndex;
+        return true;
+    }
     
 public:
     // Constructor: Verilen kapasite ile stack'i initialize eder
-    explicit ArrayStack(int cap) : capacity(cap), topIndex(-1) {
+    explicit ArrayStack(int cap, bool grow = false) : capacity(cap), topIndex(-1), growable(grow) {
         if (cap <= 0) {
             throw std::invalid_argument("Kapasite pozitif olmalıdır");
         }
-        elements = new T[capacity];
+        elements = allocate(capacity);
     }
     
     // Copy constructor
-    ArrayStack(const ArrayStack& other) : capacity(other.capacity), topIndex(other.topIndex) {
-        elements = new T[capacity];
-        for (int i = 0; i <= topIndex; i++) {
-            elements[i] = other.elements[i];
+    ArrayStack(const ArrayStack& other) : capacity(other.capacity), topIndex(-1), growable(other.growable) {
+        elements = allocate(capacity);
+        try {
+            std::uninitialized_copy(other.elements, other.elements + other.size(), elements);
+        } catch (...) {
+            deallocate(elements, capacity);
+            throw;
         }
+        topIndex = other.topIndex;
     }
     
     // Move constructor
     ArrayStack(ArrayStack&& other) noexcept : elements(other.elements), 
                                             capacity(other.capacity), 
-                                            topIndex(other.topIndex) {
+                                            topIndex(other.topIndex),
+                                            growable(other.growable) {
         other.elements = nullptr;
         other.capacity = 0;
         other.topIndex = -1;
     }
     
+    // Copy ve move assignment (copy-and-swap)
+    ArrayStack& operator=(ArrayStack other) noexcept {
+        std::swap(elements, other.elements);
+        std::swap(capacity, other.capacity);
+        std::swap(topIndex, other.topIndex);
+        std::swap(growable, other.growable);
+        return *this;
+    }
+    
     // Destructor
     ~ArrayStack() {
-        delete[] elements;
+        destroyElements();
+        deallocate(elements, capacity);
     }
     
     // Stack'e eleman ekler
     void push(const T& value) {
-        if (isFull()) {
-            throw std::overflow_error("Stack dolu");
+        emplace(value);
+    }
+    
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+    
+    // Elemanı yerinde kurar ve referansını döndürür
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        if (topIndex + 1 == capacity) {
+            if (!growable) {
+                throw std::overflow_error("Stack dolu");
+            }
+            // Argümanlar stack'teki bir elemana referans olabilir: büyümeden önce kurulur
+            return growAndPush(T(std::forward<Args>(args)...));
         }
-        elements[++topIndex] = value;
+        T* slot = new (elements + topIndex + 1) T(std::forward<Args>(args)...);
+        ++topIndex;
+        return *slot;
     }
     
-    // Stack'ten eleman çıkarır ve döndürür
+    // İstisnasız push: stack dolu ve büyüyemiyorsa false
+    bool tryPush(const T& value) {
+        return tryPushImpl(value);
+    }
+    
+    bool tryPush(T&& value) {
+        return tryPushImpl(std::move(value));
+    }
+    
+    // Stack'ten eleman çıkarır ve döndürür (eleman taşınır, kopyalanmaz)
     T pop() {
         if (isEmpty()) {
             throw std::underflow_error("Stack boş");
         }
-        return elements[topIndex--];
+        T value = std::move(elements[topIndex]);
+        elements[topIndex--].~T();
+        return value;
+    }
+    
+    // İstisnasız pop: boşsa false
+    bool tryPop(T& value) {
+        if (isEmpty()) {
+            return false;
+        }
+        value = std::move(elements[topIndex]);
+        elements[topIndex--].~T();
+        return true;
+    }
+    
+    // values[0..count) sırayla push edilir (values[count - 1] en üstte); yer yoksa hiçbiri eklenmez.
+    // values stack'in kendi elemanlarını göstermemelidir.
+    void pushMany(const T* values, int count) {
+        if (count < 0) {
+            throw std::invalid_argument("Eleman sayısı negatif olamaz");
+        }
+        if (!makeRoom(count)) {
+            throw std::overflow_error("Stack dolu");
+        }
+        std::uninitialized_copy(values, values + count, elements + topIndex + 1);
+        topIndex += count;
+    }
+    
+    // Üstteki count elemanı out[0..count) aralığına stack sırasıyla taşır (out[count - 1] eski top);
+    // pushMany(v, n) ardından popMany(out, n) out'u v ile aynı yapar. Yeterli eleman yoksa hiçbiri çıkmaz.
+    void popMany(T* out, int count) {
+        if (count < 0) {
+            throw std::invalid_argument("Eleman sayısı negatif olamaz");
+        }
+        if (count > size()) {
+            throw std::underflow_error("Stack boş");
+        }
+        T* first = elements + (topIndex + 1 - count);
+        std::move(first, elements + topIndex + 1, out);
+        if (!std::is_trivially_destructible<T>::value) {
+            for (int i = 0; i < count; i++) {
+                first[i].~T();
+            }
+        }
+        topIndex -= count;
     }
     
     // Stack'in en üstündeki elemanı döndürür
@@ -72,9 +246,13 @@ public:
         return topIndex == -1;
     }
     
-    // Stack'in dolu olup olmadığını kontrol eder
+    // Stack'in dolu olup olmadığını kontrol eder (growable stack hiçbir zaman dolu değildir)
     bool isFull() const {
-        return topIndex == capacity - 1;
+        return !growable && topIndex == capacity - 1;
+    }
+    
+    bool isGrowable() const {
+        return growable;
     }
     
     // Stack'teki eleman sayısını döndürür
@@ -82,9 +260,21 @@ public:
         return topIndex + 1;
     }
     
-    // Stack'i temizler
+    // Mevcut kapasiteyi döndürür
+    int getCapacity() const {
+        return capacity;
+    }
+    
+    // Kapasiteyi en az cap yapar (sabit kapasiteli stack'te de kullanılabilir)
+    void reserve(int cap) {
+        if (cap > capacity) {
+            reallocate(cap);
+        }
+    }
+    
+    // Stack'i temizler (yıkıcısı önemsiz tiplerde O(1))
     void clear() {
-        topIndex = -1;
+        destroyElements();
     }
 };
 
@@ -0,0 +1,228 @@
+#include "stack.h"
+#include "lock_free_stack.h"
+#include "segmented_stack.h"
+#include "expression.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Ölçülen döngülerin sonucu; derleyicinin işi atmasını önlemek için sonda yazdırılır
+std::atomic<long long> benchmarkSink{0};
+
+// threadCount thread toplam operations push + pop çiftini paylaşır; tüm thread'ler aynı anda başlar.
+// Dönen değer milisaniye cinsinden süredir.
+template <typename Push, typename Pop>
+double contention(int threadCount, int operations, Push push, Pop pop) {
+    std::atomic<int> ready{0};
+    std::atomic<bool> start{false};
+    std::vector<std::thread> workers;
+    int perThread = operations / threadCount;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            long long local = 0;
+            for (int i = 0; i < perThread; i++) {
+                push(t + i);
+                local += pop();
+            }
+            benchmarkSink.fetch_add(local);
+        });
+    }
+    while (ready.load() != threadCount) {
+        std::this_thread::yield();
+    }
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+    for (auto& w : workers) {
+        w.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+// Fonksiyonu bir kez çalıştırıp süreyi (ms) döndürür
+template <typename F>
+double measure(F&& f) {
+    auto begin = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+// İfade değerlendirici benzeri tek thread yük: derinliği 0..depth arasında gidip gelen push/pop dizisi
+template <typename Step>
+double evaluatorLoop(int operations, int depth, Step step) {
+    return measure([&] {
+        long long local = 0;
+        for (int i = 0; i < operations; i++) {
+            local += step(i, depth);
+        }
+        benchmarkSink.fetch_add(local);
+    });
+}
+
+int main() {
+    const int operations = 1 << 20;
+    std::cout << "-- Çekişme: " << operations << " push + pop çifti thread'lere bölünür (donanım thread'i: "
+              << std::thread::hardware_concurrency() << ") --\n";
+    for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+        LinkedStack<int> locked;
+        std::mutex mutex;
+        double mutexMs = contention(threads, operations,
+            [&](int v) { std::lock_guard<std::mutex> lock(mutex); locked.push(v); },
+            [&] {
+                std::lock_guard<std::mutex> lock(mutex);
+                return locked.isEmpty() ? 0 : locked.pop();
+            });
+
+        LockFreeStack<int> treiber;
+        double treiberMs = contention(threads, operations,
+            [&](int v) { treiber.push(v); },
+            [&] { int v = 0; treiber.tryPop(v); return v; });
+
+        LockFreeStack<int> eliminating(true);
+        double eliminationMs = contention(threads, operations,
+            [&](int v) { eliminating.push(v); },
+            [&] { int v = 0; eliminating.tryPop(v); return v; });
+
+        std::cout << threads << " thread: mutex + LinkedStack " << mutexMs << " ms, LockFreeStack " << treiberMs
+                  << " ms, elimination " << eliminationMs << " ms ("
+                  << operations / (treiberMs * 1e-3) / 1e6 << " M çift/s lock-free)\n";
+    }
+
+    std::cout << "\n-- ArrayStack hızlı yol: 50M adım, her adımda 1-8 push + hepsini pop (tek thread) --\n";
+    {
+        const int pairs = 50000000;
+        const int depth = 64;
+        ArrayStack<long long> throwing(depth);
+        double throwingMs = evaluatorLoop(pairs, depth, [&](int i, int d) {
+            for (int k = 0; k < d && k <= (i & 7); k++) throwing.push(i + k);
+            long long sum = 0;
+            while (!throwing.isEmpty()) sum += throwing.pop();
+            return sum;
+        });
+        ArrayStack<long long> tryStack(depth);
+        double tryMs = evaluatorLoop(pairs, depth, [&](int i, int d) {
+            for (int k = 0; k < d && k <= (i & 7); k++) tryStack.tryPush(i + k);
+            long long sum = 0, value;
+            while (tryStack.tryPop(value)) sum += value;
+            return sum;
+        });
+        ArrayStack<long long> growing(1, true);
+        double growingMs = evaluatorLoop(pairs, depth, [&](int i, int d) {
+            for (int k = 0; k < d && k <= (i & 7); k++) growing.emplace(i + k);
+            long long sum = 0, value;
+            while (growing.tryPop(value)) sum += value;
+            return sum;
+        });
+        std::cout << "push/pop (istisnalı) " << throwingMs << " ms, tryPush/tryPop " << tryMs
+                  << " ms, growable + emplace " << growingMs << " ms\n";
+
+        const int block = 1 << 20;
+        std::vector<long long> input(block), output(block);
+        for (int i = 0; i < block; i++) input[i] = i;
+        ArrayStack<long long> batch(block);
+        double loopMs = measure([&] {
+            for (int r = 0; r < 20; r++) {
+                for (int i = 0; i < block; i++) batch.push(input[i]);
+                for (int i = block - 1; i >= 0; i--) output[i] = batch.pop();
+            }
+        });
+        double manyMs = measure([&] {
+            for (int r = 0; r < 20; r++) {
+                batch.pushMany(input.data(), block);
+                batch.popMany(output.data(), block);
+            }
+        });
+        benchmarkSink.fetch_add(output[block / 2]);
+        std::cout << "20 x 1M eleman: tek tek push/pop " << loopMs << " ms, pushMany/popMany " << manyMs << " ms\n";
+    }
+
+    std::cout << "\n-- Derin stack: 20M push, sonra 20M pop (long long) --\n";
+    {
+        const long long depth = 20000000;
+        auto deep = [&](auto& stack) {
+            return measure([&] {
+                for (long long i = 0; i < depth; i++) stack.push(i);
+                long long sum = 0;
+                while (!stack.isEmpty()) sum += stack.pop();
+                benchmarkSink.fetch_add(sum);
+            });
+        };
+        ArrayStack<long long> array(16, true);
+        LinkedStack<long long> linked;
+        SegmentedStack<long long> segmented;
+        SegmentedStack<long long> spilling(8);
+        double arrayMs = deep(array);
+        double linkedMs = deep(linked);
+        double segmentedMs = deep(segmented);
+        double spillMs = deep(spilling);
+        std::cout << "ArrayStack (growable) " << arrayMs << " ms, LinkedStack " << linkedMs << " ms, SegmentedStack "
+                  << segmentedMs << " ms, SegmentedStack (bellekte en fazla 8 chunk, gerisi dosyada) " << spillMs
+                  << " ms\n";
+
+        // Chunk sınırında gidip gelme: histerezis yedeği sayesinde new/delete yok
+        const int cap = SegmentedStack<long long>::CHUNK_CAPACITY;
+        for (int i = 0; i < cap; i++) segmented.push(i);
+        double boundaryMs = measure([&] {
+            for (int i = 0; i < 10000000; i++) {
+                segmented.push(i);
+                benchmarkSink.fetch_add(segmented.pop(), std::memory_order_relaxed);
+            }
+        });
+        std::cout << "Chunk sınırında 10M push + pop: " << boundaryMs << " ms\n";
+    }
+
+    std::cout << "\n-- İfade değerlendirme: 4M satır --\n";
+    {
+        const size_t rows = 4000000;
+        std::mt19937_64 rng(43);
+        std::uniform_real_distribution<double> dist(-10.0, 10.0);
+        std::vector<double> x(rows), y(rows), z(rows), out(rows);
+        for (size_t r = 0; r < rows; r++) {
+            x[r] = dist(rng);
+            y[r] = dist(rng);
+            z[r] = dist(rng);
+        }
+        const char* formulas[] = {"a*x + b", "(x - y) * (x + 0.5) / (1 + y*y) - z*3 + x*y*z"};
+        for (const char* text : formulas) {
+            CompiledExpression expression(text, {"x", "y", "z", "a", "b"});
+            std::vector<double> a(rows, 2.0), b(rows, -1.0);
+            double rowMs = measure([&] {
+                double row[5];
+                for (size_t r = 0; r < rows; r++) {
+                    row[0] = x[r];
+                    row[1] = y[r];
+                    row[2] = z[r];
+                    row[3] = 2.0;
+                    row[4] = -1.0;
+                    out[r] = expression.evaluate(row);
+                }
+            });
+            double columnMs = measure([&] {
+                expression.evaluateColumns({x.data(), y.data(), z.data(), a.data(), b.data()}, rows, out.data());
+            });
+            benchmarkSink.fetch_add(static_cast<long long>(out[rows / 2]));
+            std::cout << "\"" << text << "\" (" << expression.getCode().size() << " talimat): satır satır " << rowMs
+                      << " ms, sütunlu " << columnMs << " ms\n";
+        }
+        double nativeMs = measure([&] {
+            for (size_t r = 0; r < rows; r++) {
+                out[r] = (x[r] - y[r]) * (x[r] + 0.5) / (1 + y[r] * y[r]) - z[r] * 3 + x[r] * y[r] * z[r];
+            }
+        });
+        benchmarkSink.fetch_add(static_cast<long long>(out[rows / 3]));
+        std::cout << "Aynı ikinci formül derlenmiş C++ olarak: " << nativeMs << " ms\n";
+    }
+
+    std::cout << "(" << benchmarkSink.load() % 10 << ")\n";
+    return 0;
+}
@@ -1,7 +1,17 @@
 #include "stack.h"
+#include "lock_free_stack.h"
+#include "segmented_stack.h"
+#include "expression.h"
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cmath>
 #include <iostream>
+#include <memory>
+#include <random>
 #include <string>
+#include <thread>
+#include <vector>
 
 // Array Stack için test fonksiyonları
 void testArrayStackBasicOperations() {
@@ -61,6 +71,99 @@ void testArrayStackWithStrings() {
     assert(stack.isEmpty());
 }
 
+void testArrayStackGrowable() {
+    ArrayStack<std::string> stack(2, true);
+    assert(stack.isGrowable() && !stack.isFull());
+    for (int i = 0; i < 100; i++) {
+        stack.push(std::to_string(i));
+    }
+    assert(stack.size() == 100 && stack.getCapacity() >= 100);
+    assert(stack.peek() == "99");
+    // Büyüme sırasında stack'teki bir elemana referansla push
+    stack.push(stack.peek());
+    assert(stack.pop() == "99" && stack.pop() == "99");
+    for (int i = 98; i >= 0; i--) {
+        assert(stack.pop() == std::to_string(i));
+    }
+    assert(stack.isEmpty());
+    
+    // Copy assignment ve reserve
+    ArrayStack<std::string> other(1);
+    other.push("x");
+    stack = other;
+    assert(stack.size() == 1 && stack.pop() == "x" && other.size() == 1);
+    other.reserve(10);
+    assert(other.getCapacity() == 10 && other.peek() == "x");
+}
+
+void testArrayStackFastPath() {
+    // try_push / try_pop: istisna yok
+    ArrayStack<int> fixed(2);
+    assert(fixed.tryPush(1) && fixed.tryPush(2) && !fixed.tryPush(3));
+    int value = 0;
+    assert(fixed.tryPop(value) && value == 2);
+    assert(fixed.tryPop(value) && value == 1);
+    assert(!fixed.tryPop(value));
+    ArrayStack<int> growing(1, true);
+    for (int i = 0; i < 10; i++) {
+        assert(growing.tryPush(i));
+    }
+    assert(growing.size() == 10);
+    
+    // emplace ve taşıyan pop: yalnızca taşınabilen tip
+    ArrayStack<std::unique_ptr<int>> owners(1, true);
+    owners.emplace(new int(7));
+    *owners.emplace(std::make_unique<int>(8)) += 1;
+    std::unique_ptr<int> top = owners.pop();
+    assert(*top == 9 && *owners.pop() == 7);
+    assert(owners.tryPush(std::move(top)) && !top && *owners.pop() == 9);
+    ArrayStack<std::unique_ptr<int>> single(1);
+    std::unique_ptr<int> spare = std::make_unique<int>(3);
+    assert(single.tryPush(std::make_unique<int>(1)) && !single.tryPush(std::move(spare)) && spare);
+    
+    // pushMany / popMany
+    ArrayStack<std::string> batch(4);
+    const std::string words[3] = {"a", "b", "c"};
+    batch.pushMany(words, 3);
+    assert(batch.size() == 3 && batch.peek() == "c");
+    try {
+        batch.pushMany(words, 3);
+        assert(false); // Bu satıra ulaşılmamalı
+    } catch (const std::overflow_error& e) {
+        // Beklenen durum: hiçbiri eklenmez
+    }
+    assert(batch.size() == 3);
+    std::string out[3];
+    batch.popMany(out, 2);
+    assert(out[0] == "b" && out[1] == "c" && batch.size() == 1 && batch.peek() == "a");
+    try {
+        batch.popMany(out, 2);
+        assert(false); // Bu satıra ulaşılmamalı
+    } catch (const std::underflow_error& e) {
+        // Beklenen durum
+    }
+    
+    ArrayStack<int> numbers(1, true);
+    std::vector<int> input(1000);
+    for (int i = 0; i < 1000; i++) {
+        input[i] = i;
+    }
+    numbers.pushMany(input.data(), 1000);
+    std::vector<int> output(1000);
+    numbers.popMany(output.data(), 1000);
+    assert(output == input && numbers.isEmpty());
+    
+    // Toplam boyut int'e sığmıyorsa büyümeden reddedilir (values okunmaz)
+    numbers.push(1);
+    try {
+        numbers.pushMany(input.data(), INT_MAX);
+        assert(false); // Bu satıra ulaşılmamalı
+    } catch (const std::overflow_error& e) {
+        // Beklenen durum
+    }
+    assert(numbers.size() == 1);
+}
+
 // Linked Stack için test fonksiyonları
 void testLinkedStackBasicOperations() {
     // Test: Constructor ve temel operasyonlar
@@ -140,6 +243,307 @@ void testStackCopyAndMove() {
     LinkedStack<int> linkedStack3 = std::move(linkedStack1);
 }
 
+// Segmentli stack için test fonksiyonları
+void testSegmentedStackBasicOperations() {
+    SegmentedStack<std::string> stack;
+    assert(stack.isEmpty() && !stack.isFull() && stack.size() == 0);
+    stack.push("Merhaba");
+    stack.emplace(3, 'x');
+    assert(stack.peek() == "xxx" && stack.size() == 2);
+    assert(stack.pop() == "xxx" && stack.pop() == "Merhaba");
+    std::string value;
+    assert(!stack.tryPop(value));
+    try {
+        stack.pop();
+        assert(false); // Bu satıra ulaşılmamalı
+    } catch (const std::underflow_error& e) {
+        // Beklenen durum
+    }
+    
+    // Chunk sınırlarını aşan büyüme ve boşalma; ArrayStack ile karşılaştırılır
+    const int cap = SegmentedStack<int>::CHUNK_CAPACITY;
+    SegmentedStack<int> segmented;
+    ArrayStack<int> reference(1, true);
+    for (int i = 0; i < 3 * cap + 5; i++) {
+        segmented.push(i);
+        reference.push(i);
+    }
+    assert(segmented.size() == static_cast<size_t>(reference.size()) && segmented.getResidentChunks() == 4);
+    // Chunk sınırında gidip gelme: yedek chunk yeniden kullanılır
+    while (segmented.size() > static_cast<size_t>(3 * cap)) {
+        segmented.pop();
+        reference.pop();
+    }
+    for (int round = 0; round < 1000; round++) {
+        segmented.push(round);
+        assert(segmented.pop() == round);
+    }
+    assert(segmented.getResidentChunks() == 3);
+    while (!reference.isEmpty()) {
+        assert(segmented.pop() == reference.pop());
+    }
+    assert(segmented.isEmpty() && segmented.getResidentChunks() == 0);
+    
+    // pushMany / popMany chunk sınırlarının ötesinde
+    std::vector<int> input(2 * cap + 17);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<int>(i);
+    }
+    segmented.push(-1);
+    segmented.pushMany(input.data(), static_cast<int>(input.size()));
+    std::vector<int> output(input.size());
+    segmented.popMany(output.data(), static_cast<int>(output.size()));
+    assert(output == input && segmented.size() == 1 && segmented.peek() == -1);
+    
+    SegmentedStack<std::string> words;
+    const std::string many[3] = {"a", "b", "c"};
+    words.pushMany(many, 3);
+    std::string out[2];
+    words.popMany(out, 2);
+    assert(out[0] == "b" && out[1] == "c" && words.peek() == "a");
+    SegmentedStack<std::string> moved = std::move(words);
+    assert(moved.size() == 1 && words.isEmpty());
+    words.push("x");
+    moved = std::move(words);  // Eski içerik bırakılır
+    assert(moved.size() == 1 && moved.peek() == "x" && words.isEmpty());
+    std::string item = "y";
+    assert(moved.tryPush(std::move(item)) && moved.peek() == "y");
+}
+
+void testSegmentedStackSpill() {
+    const int cap = SegmentedStack<long long>::CHUNK_CAPACITY;
+    const long long total = 10LL * cap + 123;
+    SegmentedStack<long long> stack(3);
+    for (long long i = 0; i < total; i++) {
+        stack.push(i * 7);
+    }
+    assert(stack.size() == static_cast<size_t>(total));
+    assert(stack.getResidentChunks() <= 3 && stack.getSpilledChunks() == 8);
+    for (long long i = total - 1; i >= 0; i--) {
+        assert(stack.pop() == i * 7);
+        assert(stack.getResidentChunks() <= 3);
+    }
+    assert(stack.isEmpty() && stack.getSpilledChunks() == 0);
+    
+    // Dosyaya yazmış iki stack arasında taşıyarak atama: hedefin chunk'ları ve dosyası bırakılır
+    SegmentedStack<long long> other(2);
+    for (long long i = 0; i < 4LL * cap; i++) {
+        stack.push(i);
+        other.push(-i);
+    }
+    stack = std::move(other);
+    assert(stack.size() == static_cast<size_t>(4LL * cap) && stack.getSpilledChunks() == 2 && other.isEmpty());
+    for (long long i = 4LL * cap - 1; i >= 0; i--) {
+        assert(stack.pop() == -i);
+    }
+    
+    stack.push(1);
+    stack.clear();
+    assert(stack.isEmpty() && stack.size() == 0);
+    
+    try {
+        SegmentedStack<std::string> invalid(4);
+        assert(false); // Bu satıra ulaşılmamalı
+    } catch (const std::invalid_argument& e) {
+        // Beklenen durum: string dosyaya yazılamaz
+    }
+}
+
+// İfade derleyicisi testleri
+void testExpressionCompiler() {
+    CompiledExpression simple("3 + 4 * 2 / (1 - 5) ^ 2 ^ 3", {});
+    assert(simple.toPostfix() == "3 4 2 * 1 5 - 2 3 ^ ^ / +");
+    assert(std::fabs(simple.evaluate(std::vector<double>()) - (3 + 8.0 / 65536)) < 1e-12);
+    
+    CompiledExpression unary("-x^2 + -(-y) * 2^-1", {"x", "y"});
+    assert(unary.evaluate({3, 4}) == -9 + 2);
+    
+    CompiledExpression functions("sqrt(x*x + y*y) + abs(-2.5) + log(exp(1))", {"x", "y"});
+    assert(std::fabs(functions.evaluate({3, 4}) - 8.5) < 1e-12);
+    assert(functions.getMaxDepth() == 3);
+    
+    // Aynı bytecode farklı değişken değerleriyle tekrar tekrar değerlendirilir
+    CompiledExpression poly("a*x^2 + b*x + c", {"x", "a", "b", "c"});
+    for (int x = -5; x <= 5; x++) {
+        assert(poly.evaluate({static_cast<double>(x), 2, -3, 1}) == 2.0 * x * x - 3.0 * x + 1);
+    }
+    
+    // Sütunlu toplu değerlendirme satır satır değerlendirmeyle aynı sonucu vermeli (blok sınırları dahil)
+    CompiledExpression formula("(x - y) * (x + 0.5) / (1 + y*y) - sin(x) * 3 + z", {"x", "y", "z"});
+    const size_t rows = 3 * EXPRESSION_BATCH_ROWS + 17;
+    std::mt19937 rng(41);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+    std::vector<double> x(rows), y(rows), z(rows), out(rows);
+    for (size_t r = 0; r < rows; r++) {
+        x[r] = dist(rng);
+        y[r] = dist(rng);
+        z[r] = dist(rng);
+    }
+    formula.evaluateColumns({x.data(), y.data(), z.data()}, rows, out.data());
+    for (size_t r = 0; r < rows; r++) {
+        assert(out[r] == formula.evaluate({x[r], y[r], z[r]}));
+    }
+    CompiledExpression constant("2 * 21", {"x"});
+    constant.evaluateColumns({x.data()}, 5, out.data());
+    assert(out[0] == 42 && out[4] == 42);
+    
+    // Derleme hataları
+    const char* invalid[] = {"1 +", "(1 + 2", "1 + 2)", "* 3", "x y", "2 3", "foo(1)", "1 $ 2", "sqrt 4", "()"};
+    for (const char* text : invalid) {
+        try {
+            CompiledExpression broken(text, {"x", "y"});
+            assert(false); // Bu satıra ulaşılmamalı
+        } catch (const std::invalid_argument& e) {
+            // Beklenen durum
+        }
+    }
+}
+
+// Lock-free stack için test fonksiyonları
+void testLockFreeStackBasicOperations() {
+    LockFreeStack<std::string> stack;
+    assert(stack.isEmpty());
+    stack.push("Merhaba");
+    stack.push("Dünya");
+    assert(stack.size() == 2);
+    assert(stack.peek() == "Dünya");
+    assert(stack.pop() == "Dünya");
+    std::string value;
+    assert(stack.tryPop(value) && value == "Merhaba");
+    assert(!stack.tryPop(value));
+    
+    try {
+        stack.pop();
+        assert(false); // Bu satıra ulaşılmamalı
+    } catch (const std::underflow_error& e) {
+        // Beklenen durum
+    }
+    try {
+        stack.peek();
+        assert(false); // Bu satıra ulaşılmamalı
+    } catch (const std::underflow_error& e) {
+        // Beklenen durum
+    }
+    
+    stack.push("a");
+    stack.push("b");
+    stack.clear();
+    assert(stack.isEmpty() && stack.size() == 0);
+}
+
+// Kopyası istenen thread'de istisna fırlatan tip; value == 1 olan canlı nesneler sayılır
+struct ThrowingCopy {
+    int value;
+    static inline std::atomic<int> liveMarked{0};
+    static inline thread_local bool failCopies = false;
+
+    explicit ThrowingCopy(int v) : value(v) { if (value == 1) liveMarked++; }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+        if (failCopies) throw std::runtime_error("Kopyalanamadı");
+        if (value == 1) liveMarked++;
+    }
+    ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+    ~ThrowingCopy() { if (value == 1) liveMarked--; }
+};
+
+// peek kopyalarken istisna olursa hazard slotu temizlenmeli; yoksa düğüm hiç silinmez
+void testLockFreeStackPeekThrows() {
+    LockFreeStack<ThrowingCopy> stack;
+    stack.push(ThrowingCopy(1));
+    std::atomic<int> phase{0};
+    std::thread reader([&] {
+        ThrowingCopy::failCopies = true;
+        bool threw = false;
+        try {
+            stack.peek();
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+        phase.store(1);
+        while (phase.load() != 2) std::this_thread::yield();  // Thread (ve slotu) canlı kalır
+    });
+    while (phase.load() != 1) std::this_thread::yield();
+    stack.pop();
+    assert(ThrowingCopy::liveMarked.load() == 1);  // Yalnızca retire edilmiş düğümdeki kopya
+    for (size_t i = 0; i < 2 * HAZARD_RETIRE_THRESHOLD; i++) {
+        stack.push(ThrowingCopy(2));
+        stack.pop();
+    }
+    assert(ThrowingCopy::liveMarked.load() == 0);
+    phase.store(2);
+    reader.join();
+}
+
+// Üreticiler ve tüketiciler aynı anda çalışır; her eleman tam bir kez çıkmalı
+void checkLockFreeStackConcurrent(bool elimination) {
+    const int threads = 4;
+    const int perThread = 20000;
+    LockFreeStack<int> stack(elimination);
+    std::vector<std::vector<int>> popped(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < perThread; i++) {
+                stack.push(t * perThread + i);
+                int value;
+                if (i % 2 == 1 && stack.tryPop(value)) {
+                    popped[t].push_back(value);
+                }
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    std::vector<int> all;
+    for (const auto& list : popped) {
+        all.insert(all.end(), list.begin(), list.end());
+    }
+    int value;
+    while (stack.tryPop(value)) {
+        all.push_back(value);
+    }
+    assert(static_cast<int>(all.size()) == threads * perThread);
+    std::sort(all.begin(), all.end());
+    for (int i = 0; i < threads * perThread; i++) {
+        assert(all[i] == i);
+    }
+}
+
+// peek, pop ile aynı anda okunan düğümü görebilir: pop veriyi değiştirmemeli (TSan ile de çalıştırılır)
+void checkLockFreeStackPeekDuringPop() {
+    const std::string base = "taban eleman, küçük string optimizasyonundan uzun";
+    LockFreeStack<std::string> stack;
+    stack.push(base);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 2; t++) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                std::string value = stack.peek();  // Taban hiç çıkmadığı için boş olmaz
+                assert(value == base || value.compare(0, 7, "eleman-") == 0);
+            }
+        });
+    }
+    for (int i = 0; i < 20000; i++) {
+        stack.push("eleman-" + std::to_string(i) + " yine SSO sınırından uzun bir metin");
+        std::string value = stack.pop();
+        assert(value.compare(0, 7, "eleman-") == 0);
+    }
+    done.store(true);
+    for (auto& r : readers) {
+        r.join();
+    }
+    assert(stack.size() == 1 && stack.pop() == base);
+}
+
+void testLockFreeStackConcurrent() {
+    checkLockFreeStackConcurrent(false);
+    checkLockFreeStackConcurrent(true);
+    checkLockFreeStackPeekDuringPop();
+}
+
 int main() {
     std::cout << "Stack testleri başlıyor...\n";
     
@@ -148,6 +552,8 @@ int main() {
     testArrayStackBasicOperations();
     testArrayStackErrorCases();
     testArrayStackWithStrings();
+    testArrayStackGrowable();
+    testArrayStackFastPath();
     
     // Linked Stack testleri
     std::cout << "Linked Stack testleri:\n";
@@ -155,6 +561,21 @@ int main() {
     testLinkedStackErrorCases();
     testLinkedStackWithStrings();
     
+    // Segmentli stack testleri
+    std::cout << "Segmented Stack testleri:\n";
+    testSegmentedStackBasicOperations();
+    testSegmentedStackSpill();
+    
+    // İfade derleyicisi testleri
+    std::cout << "Expression Compiler testleri:\n";
+    testExpressionCompiler();
+    
+    // Lock-free stack testleri
+    std::cout << "Lock-free Stack testleri:\n";
+    testLockFreeStackBasicOperations();
+    testLockFreeStackPeekThrows();
+    testLockFreeStackConcurrent();
+    
     // Copy ve Move testleri
     std::cout << "Copy ve Move semantics testleri:\n";
     testStackCopyAndMove();